@@ -415,7 +415,7 @@ IMP_S32 IMP_VDEC_StopRecvStream(IMP_S32 s32DevId);
  *
  * @param[in] s32DevId Device号,取值范围:[0, @ref NR_MAX_VDEC_DEV - 1]
  * @param[in] pstStream 解码码流数据指针
- * @param[in] s32MilliSec 送码流方式
+ * @param[in] s32MilliSec 送码流超时时间(单位:ms)
  *
  * @retval 0 成功
  * @retval 非0 失败
@@ -546,7 +546,7 @@ IMP_S32 IMP_VDEC_SetUserPic(IMP_S32 s32DevId, const FRAME_INFO_S *pstUsrPic);
 IMP_S32 IMP_VDEC_EnableUserPic(IMP_S32 s32DevId, IMP_BOOL bInstant);
 
 /**
- * @fn IMP_S32 IMP_VDEC_DisableUserPic(IMP_S32 s32DevId, IMP_BOOL bInstant)
+ * @fn IMP_S32 IMP_VDEC_DisableUserPic(IMP_S32 s32DevId)
  *
  * 禁止使能插入解码用户图片
  *
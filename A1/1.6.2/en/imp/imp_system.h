@@ -328,9 +328,9 @@ IMP_S32 IMP_System_CloseFd(IMP_VOID);
  *
  * create mempool on rmem
  *
- * @param[in] pu32PoolId 	mempool id address.
+ * @param[out] pu32PoolId 	mempool id address.
  * @param[in] u32BlkSize	block size in mempool,unit bytes.
- * @param[in] u32BlkSize	number of blocks in mempool.
+ * @param[in] u32BlkCnt	number of blocks in mempool.
  * @param[in] pcPoolName	mempool name.
  *
  * @retval IMP_SUCCESS success
@@ -353,9 +353,9 @@ IMP_S32 IMP_System_CreatPool(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_U32 u3
  *
  * Create mempool on rmem aligned.
  *
- * @param[in] pu32PoolId 	mempool id address.
+ * @param[out] pu32PoolId 	mempool id address.
  * @param[in] u32BlkSize	block size in mempool,unit bytes.
- * @param[in] u32BlkSize	number of blocks in mempool.
+ * @param[in] u32BlkCnt	number of blocks in mempool.
  * @param[in] pcPoolName	mempool name.
  * @param[in] s32AlignWidth	aligned bytes.
  *
@@ -379,17 +379,19 @@ IMP_S32 IMP_System_CreatPool_Align(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_
  *
  * Destroy the mempool
  *
- * @param[in] u32PoolId 	ID of destroy mempool，priority matching ID, ignore pcName if matching is successful.
+ * @param[in] u32PoolId 	ID of destroy mempool，priority matching ID, ignore pcPoolName if matching is successful.
  * @param[in] pcPoolName	mempool name. matching name when u32PoolId is invalid.
  *
  * @retval IMP_SUCCESS success
  * @retval un IMP_SUCCESS failure.
  *
  * @remarks
- * destroy mempool，priority matching ID, ignore pcName if matching is successful,
+ * destroy mempool，priority matching ID, ignore pcPoolName if matching is successful,
  * matching name when u32PoolId is invalid.
+ * After the mempool is destroyed, all blocks allocated from it are released,
+ * accessing them afterwards leads to unpredictable errors.
  *
- * @attention null.
+ * @attention pcPoolName can be NULL when u32PoolId is valid. It is recommended to call it after all blocks are released.
  */
 IMP_S32 IMP_System_DestroyPool(IMP_U32 u32PoolId, const char *pcPoolName);
 
@@ -398,9 +400,9 @@ IMP_S32 IMP_System_DestroyPool(IMP_U32 u32PoolId, const char *pcPoolName);
  *
  * get block from u32PoolId or pcPoolName
  *
- * @param[in] u32PoolId 	priority matching ID, ignore pcName if matching is successful.
- * @param[in] pcName		matching name when u32PoolId is invalid. after successful matching, allocate blocks from the pool.
- * @param[in] Size		 	block size.
+ * @param[in] u32PoolId 	priority matching ID, ignore pcPoolName if matching is successful.
+ * @param[in] pcPoolName	matching name when u32PoolId is invalid. after successful matching, allocate blocks from the pool.
+ * @param[in] u32Size		block size.
  * @param[in] pcBlkName		block name, cannot be null.
  *
  *
@@ -409,7 +411,7 @@ IMP_S32 IMP_System_DestroyPool(IMP_U32 u32PoolId, const char *pcPoolName);
  *
  * @remarks
  *
- * @attention null.
+ * @attention pcPoolName can be NULL when u32PoolId is valid.
  */
 IMP_VOID *IMP_System_GetBlock(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32 u32Size, const char *pcBlkName);
 
@@ -440,7 +442,7 @@ IMP_S32 IMP_System_ReleaseBlock(IMP_U32 u32PoolId, IMP_VOID *pBlockVaddr);
  *
  *
  * @retval successful return the physics address of the block
- * @retval failure return IMP_NULL
+ * @retval failure return 0
  *
  * @remarks
  *
@@ -457,7 +459,7 @@ IMP_U32 IMP_System_Block2PhyAddr(IMP_VOID *pBlockVaddr);
  *
  *
  * @retval successful return the mempool ID
- * @retval failure return IMP_NULL
+ * @retval failure return 0
  *
  * @remarks
  *
@@ -107,7 +107,7 @@ typedef struct IMP_TDE_OPERATE_ENABLE
 typedef enum IMP_TDE_ALUCMD
 {
 	TDE_ALUCMD_NONE = 0,
-	TDE_ALUCMD_BLEND,
+	TDE_ALUCMD_BLEND,	/* supports proportional overlay of images, foreground and background can use different blend factors */
 	TDE_ALUCMD_ROP,
 	TDE_ALUCMD_BUTT
 } TDE_ALUCMD_E;
@@ -117,8 +117,8 @@ typedef enum IMP_TDE_ALUCMD
  */
 typedef enum IMP_CLIPMODE
 {
-	TDE_CLIPMODE_OUTSIDE = 0,	/* clip outside */
-	TDE_CLIPMODE_INSIDE,		/* clip inside*/
+	TDE_CLIPMODE_OUTSIDE = 0,	/* output the image outside the clip region */
+	TDE_CLIPMODE_INSIDE,		/* output the image inside the clip region */
 	TDE_CLIPMODE_BUTT
 } TDE_CLIPMODE_E;
 
@@ -162,11 +162,11 @@ typedef enum IMP_TDE_COLORKEY_MODE
  */
 typedef struct IMP_TDE_COLORKEY_COMP
 {
-	IMP_U8 u8CompMin;
-	IMP_U8 u8CompMax;
-	IMP_U8 bCompOut;
-	IMP_U8 bCompIgnore;
-	IMP_U8 u8CompMask;
+	IMP_U8 u8CompMin;	/* minimum value of the component */
+	IMP_U8 u8CompMax;	/* maximum value of the component */
+	IMP_U8 bCompOut;	/* whether the component key color is inside or outside the range */
+	IMP_U8 bCompIgnore;	/* whether the component is ignored */
+	IMP_U8 u8CompMask;	/* component mask */
 	IMP_U8 u8Reserved;
 	IMP_U8 u8Reserved1;
 	IMP_U8 u8Reserved2;
@@ -198,8 +198,8 @@ typedef union IMP_TDE_COLORKEY
  */
 typedef enum IMP_TDE_MIRROR
 {
-	TDE_MIRROR_NONE = 0,
-	TDE_MIRROR_VERTICAL,
+	TDE_MIRROR_NONE = 0,	/* no mirror on the output image */
+	TDE_MIRROR_VERTICAL,	/* output image is mirrored vertically */
 	TDE_MIRROR_BUTT
 } TDE_MIRROR_E;
 
@@ -208,9 +208,9 @@ typedef enum IMP_TDE_MIRROR
  */
 typedef enum IMP_TDE_OUTALPHA_FROM
 {
-	TDE_OUTALPHA_FROM_BACKGROUND = 0,
-	TDE_OUTALPHA_FROM_FOREGROUND,
-	TDE_OUTALPHA_FROM_GLOBALALPHA,
+	TDE_OUTALPHA_FROM_BACKGROUND = 0,	/* output alpha comes from the background image */
+	TDE_OUTALPHA_FROM_FOREGROUND,	/* output alpha comes from the foreground image */
+	TDE_OUTALPHA_FROM_GLOBALALPHA,	/* output alpha comes from the global alpha */
 	TDE_OUTALPHA_FROM_BUTT
 } TDE_OUTALPHA_FROM_E;
 
@@ -261,10 +261,10 @@ typedef enum IMP_TDE_BLENDCMD
  */
 typedef struct IMP_TDE_BLEND_OPT
 {
-	IMP_BOOL bGlobalAlphaEnable;
-	IMP_BOOL bPixelAlphaEnable;
-	IMP_BOOL bSrc1AlphaPremulti;
-	IMP_BOOL bSrc2AlphaPremulti;
+	IMP_BOOL bGlobalAlphaEnable;	/* enable global alpha */
+	IMP_BOOL bPixelAlphaEnable;	/* enable per-pixel alpha */
+	IMP_BOOL bSrc1AlphaPremulti;	/* src1 alpha is premultiplied */
+	IMP_BOOL bSrc2AlphaPremulti;	/* src2 alpha is premultiplied */
 	TDE_BLENDCMD_E eBlendCmd;
 	TDE_BLEND_MODE_E eSrc1BlendMode;
 	TDE_BLEND_MODE_E eSrc2BlendMode;
@@ -354,7 +354,7 @@ typedef struct IMP_TDE_SURFACE
 	IMP_U8 u8GlobalAlpha;
 	IMP_U8 u8Alpha0;
 	IMP_U8 u8Alpha1;
-	TDE_ALPHA1555_S stAlpha1555;	/* ARGB1555 alpha mode*/
+	TDE_ALPHA1555_S stAlpha1555;	/* ARGB1555 alpha mode selection and config */
 } TDE_SURFACE_S;
 
 /**
@@ -373,17 +373,17 @@ typedef struct IMP_TDE_RECT
  */
 typedef struct IMP_TDE_OPERATE
 {
-	TDE_OPT_TYPE_E enOptType;
-	TDE_OPERATE_ENABLE_S stOptsEn;
-	IMP_U32 u32FillData;
-	TDE_CSC_OPT_S stCscOpt;
-	TDE_RECT_S stClipRect;
-	TDE_CLIPMODE_E enClipMode;
-	TDE_MIRROR_E enMirror;
-	TDE_COLORKEY_MODE_E enColorKeyMode;
-	TDE_COLORKEY_U unColorKeyValue;
-	TDE_ROP_CODE_E enRopCode_Color;
-	TDE_ROP_CODE_E enRopCode_Alpha;
+	TDE_OPT_TYPE_E enOptType;	/* operation type */
+	TDE_OPERATE_ENABLE_S stOptsEn;	/* modules enabled for the operation */
+	IMP_U32 u32FillData;	/* fill value */
+	TDE_CSC_OPT_S stCscOpt;	/* CSC operation attribute */
+	TDE_RECT_S stClipRect;	/* clip region */
+	TDE_CLIPMODE_E enClipMode;	/* clip inside or outside the region */
+	TDE_MIRROR_E enMirror;	/* mirror type */
+	TDE_COLORKEY_MODE_E enColorKeyMode;	/* colorkey mode */
+	TDE_COLORKEY_U unColorKeyValue;	/* colorkey value */
+	TDE_ROP_CODE_E enRopCode_Color;	/* ROP type of the color space */
+	TDE_ROP_CODE_E enRopCode_Alpha;	/* ROP type of the alpha */
 	TDE_BLEND_OPT_S stBlendOpt;
 } TDE_OPERATE_S;
 
@@ -680,10 +680,10 @@ IMP_S32 IMP_TDE_BitmapMaskBlend(TDE_HANDLE Handle, TDE_SURFACE_S *pstBackGround,
  *
  * commit an already create task
  *
- * @param[in] Handle
- * @param[in] bSync
- * @param[in] bBlock
- * @param[in] s32TimeOut
+ * @param[in] Handle task handle
+ * @param[in] bSync synchronous flag (not used)
+ * @param[in] bBlock blocking flag (not used)
+ * @param[in] s32TimeOut timeout (ms)
  *
  * @retval =0 success
  * @retval !=0 failure
@@ -194,7 +194,7 @@ IMP_S32 IMP_VO_SetPubAttr(IMP_S32 s32VoMod,VO_PUB_ATTR_S *pstPubAttr);
  * Get the public attributes of the video output module.
  *
  * @param[in] s32VoMod Video output module ID.
- * @param[in] pstPubAttr Video output module public attributes.
+ * @param[out] pstPubAttr Video output module public attributes.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -244,7 +244,7 @@ IMP_S32 IMP_VO_Disable(IMP_S32 s32VoMod);
  * Get the HDMI/VGA status of the display interface on the video output module.
  *
  * @param[in] enDevIntf Interface.
- * @param[in] pstIntfStatus Interface status.
+ * @param[out] pstIntfStatus Interface status.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -322,7 +322,7 @@ IMP_S32 IMP_VO_SetVideoLayerAttr(IMP_S32 s32VoLayer,const VO_VIDEO_LAYER_ATTR_S
  * Get the video layer attributes.
  *
  * @param[in] s32VoLayer Video layer ID.
- * @param[in] pstLayerAttr The pointer of the video layer attributes.
+ * @param[out] pstLayerAttr The pointer of the video layer attributes.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -369,9 +369,9 @@ IMP_S32 IMP_VO_DisableVideoLayer(IMP_S32 s32VoLayer);
  * The structure of video channel attributes
  */
 typedef struct{
-    IMP_U32		u32Priority;
-    IMP_BOOL	bDeflicker;
-    IMP_RECT_S	stRect;
+    IMP_U32		u32Priority;	/**< Channel priority */
+    IMP_BOOL	bDeflicker;		/**< Whether to enable deflicker */
+    IMP_RECT_S	stRect;			/**< Display area of the channel on the video layer canvas */
 }VO_CHN_ATTR_S;
 
 /**
@@ -399,7 +399,7 @@ IMP_S32 IMP_VO_SetChnAttr(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,const VO_CHN_ATTR_
  *
  * @param[in] s32VoLayer Video layer ID.
  * @param[in] s32VoChn Video channel ID.
- * @param[in] pstChnAttr The pointer of video channel attributes.
+ * @param[out] pstChnAttr The pointer of video channel attributes.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -470,7 +470,7 @@ IMP_S32 IMP_VO_SetChnDispPos(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,const IMP_POINT
  *
  * @param[in] s32VoLayer Video layer ID.
  * @param[in] s32VoChn Video channel ID.
- * @param[in] pstPoint The pointer of position.
+ * @param[out] pstPoint The pointer of position.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -586,7 +586,7 @@ IMP_S32 IMP_VO_HideChnAll(IMP_S32 s32VoLayer);
  * The structure of video channel zoom attributes
  */
 typedef struct{
-	IMP_RECT_S stZoomRect;
+	IMP_RECT_S stZoomRect;	/**< Region of the channel image to be zoomed in */
 }VO_ZOOM_ATTR_S;
 
 /**
@@ -614,7 +614,7 @@ IMP_S32 IMP_VO_SetZoomInWindow(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,VO_ZOOM_ATTR_
  *
  * @param[in] s32VoLayer Video layer ID.
  * @param[in] s32VoChn Video channel ID.
- * @param[in] stZoomAttr The pointer of zoom attributes.
+ * @param[out] stZoomAttr The pointer of zoom attributes.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -644,7 +644,7 @@ IMP_S32 IMP_VO_GetZoomInWindow(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,VO_ZOOM_ATTR_
 IMP_S32 IMP_VO_ClearChnBuffer(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_BOOL bClrAll);
 
 /**
- * @fn IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
+ * @fn IMP_S32 IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
  *
  * Get frame of the video channel.
  *
@@ -680,13 +680,13 @@ IMP_S32 IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **ps
 IMP_S32 IMP_VO_ReleaseChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S *pstFrame);
 
 /**
- * @fn IMP_VO_GetChnPts(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_U64 *u64Pts)
+ * @fn IMP_S32 IMP_VO_GetChnPts(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_U64 *u64Pts)
  *
  * Get the timestamp of the current channel display frame
  *
  * @param[in] s32VoLayer Video layer ID.
  * @param[in] s32VoChn Video channel ID.
- * @param[in] u64Pts The timestamp of the current channel display frame.
+ * @param[out] u64Pts The timestamp of the current channel display frame.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -367,9 +367,9 @@ IMP_S32 IMP_System_CloseFd(IMP_VOID);
  *
  * create mempool on rmem
  *
- * @param[in] pu32PoolId 	mempool id address.
+ * @param[out] pu32PoolId 	mempool id address.
  * @param[in] u32BlkSize	block size in mempool,unit bytes.
- * @param[in] u32BlkSize	number of blocks in mempool.
+ * @param[in] u32BlkCnt	number of blocks in mempool.
  * @param[in] pcPoolName	mempool name.
  *
  * @retval IMP_SUCCESS success
@@ -388,13 +388,13 @@ IMP_S32 IMP_System_CloseFd(IMP_VOID);
 IMP_S32 IMP_System_CreatPool(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_U32 u32BlkCnt, const char *pcPoolName);
 
 /**
- * @fn IMP_S32 IMP_System_CreatPool(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_U32 u32BlkCnt, const char *pcPoolName);
+ * @fn IMP_S32 IMP_System_CreatPool_From_Tail(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_U32 u32BlkCnt, const char *pcPoolName);
  *
  * create mempool on rmem from the tail.
  *
- * @param[in] pu32PoolId 	mempool id address.
+ * @param[out] pu32PoolId 	mempool id address.
  * @param[in] u32BlkSize	block size in mempool,unit bytes.
- * @param[in] u32BlkSize	number of blocks in mempool.
+ * @param[in] u32BlkCnt	number of blocks in mempool.
  * @param[in] pcPoolName	mempool name.
  *
  * @retval IMP_SUCCESS success
@@ -417,9 +417,9 @@ IMP_S32 IMP_System_CreatPool_From_Tail(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize,
  *
  * Create mempool on rmem aligned.
  *
- * @param[in] pu32PoolId 	mempool id address.
+ * @param[out] pu32PoolId 	mempool id address.
  * @param[in] u32BlkSize	block size in mempool,unit bytes.
- * @param[in] u32BlkSize	number of blocks in mempool.
+ * @param[in] u32BlkCnt	number of blocks in mempool.
  * @param[in] pcPoolName	mempool name.
  * @param[in] s32AlignWidth	aligned bytes.
  *
@@ -439,13 +439,13 @@ IMP_S32 IMP_System_CreatPool_From_Tail(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize,
 IMP_S32 IMP_System_CreatPool_Align(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_U32 u32BlkCnt, const char *pcPoolName,IMP_S32 s32AlignWidth);
 
 /**
- * @fn IMP_S32 IMP_System_CreatPool_Align(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_U32 u32BlkCnt, const char *pcPoolName,IMP_S32 s32AlignWidth);
+ * @fn IMP_S32 IMP_System_CreatPool_Align_From_Tail(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_U32 u32BlkCnt, const char *pcPoolName,IMP_S32 s32AlignWidth);
  *
  * Create mempool on rmem aligned from the tail.
  *
- * @param[in] pu32PoolId 	mempool id address.
+ * @param[out] pu32PoolId 	mempool id address.
  * @param[in] u32BlkSize	block size in mempool,unit bytes.
- * @param[in] u32BlkSize	number of blocks in mempool.
+ * @param[in] u32BlkCnt	number of blocks in mempool.
  * @param[in] pcPoolName	mempool name.
  * @param[in] s32AlignWidth	aligned bytes.
  *
@@ -469,17 +469,19 @@ IMP_S32 IMP_System_CreatPool_Align_From_Tail(IMP_U32 *pu32PoolId, IMP_U32 u32Blk
  *
  * Destroy the mempool
  *
- * @param[in] u32PoolId 	ID of destroy mempool，priority matching ID, ignore pcName if matching is successful.
+ * @param[in] u32PoolId 	ID of destroy mempool，priority matching ID, ignore pcPoolName if matching is successful.
  * @param[in] pcPoolName	mempool name. matching name when u32PoolId is invalid.
  *
  * @retval IMP_SUCCESS success
  * @retval un IMP_SUCCESS failure.
  *
  * @remarks
- * destroy mempool，priority matching ID, ignore pcName if matching is successful,
+ * destroy mempool，priority matching ID, ignore pcPoolName if matching is successful,
  * matching name when u32PoolId is invalid.
+ * After the mempool is destroyed, all blocks allocated from it are released,
+ * accessing them afterwards leads to unpredictable errors.
  *
- * @attention null.
+ * @attention pcPoolName can be NULL when u32PoolId is valid. It is recommended to call it after all blocks are released.
  */
 IMP_S32 IMP_System_DestroyPool(IMP_U32 u32PoolId, const char *pcPoolName);
 
@@ -488,9 +490,9 @@ IMP_S32 IMP_System_DestroyPool(IMP_U32 u32PoolId, const char *pcPoolName);
  *
  * get block from u32PoolId or pcPoolName
  *
- * @param[in] u32PoolId 	priority matching ID, ignore pcName if matching is successful.
- * @param[in] pcName		matching name when u32PoolId is invalid. after successful matching, allocate blocks from the pool.
- * @param[in] Size		 	block size.
+ * @param[in] u32PoolId 	priority matching ID, ignore pcPoolName if matching is successful.
+ * @param[in] pcPoolName	matching name when u32PoolId is invalid. after successful matching, allocate blocks from the pool.
+ * @param[in] u32Size		block size.
  * @param[in] pcBlkName		block name, cannot be null.
  *
  *
@@ -499,7 +501,7 @@ IMP_S32 IMP_System_DestroyPool(IMP_U32 u32PoolId, const char *pcPoolName);
  *
  * @remarks
  *
- * @attention null.
+ * @attention pcPoolName can be NULL when u32PoolId is valid.
  */
 IMP_VOID *IMP_System_GetBlock(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32 u32Size, const char *pcBlkName);
 
@@ -508,9 +510,9 @@ IMP_VOID *IMP_System_GetBlock(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32
  *
  * get block from u32PoolId or pcPoolName,and allocate memory block from the tail of rmem.
  *
- * @param[in] u32PoolId 	priority matching ID, ignore pcName if matching is successful.
- * @param[in] pcName		matching name when u32PoolId is invalid. after successful matching, allocate blocks from the pool.
- * @param[in] Size		 	block size.
+ * @param[in] u32PoolId 	priority matching ID, ignore pcPoolName if matching is successful.
+ * @param[in] pcPoolName	matching name when u32PoolId is invalid. after successful matching, allocate blocks from the pool.
+ * @param[in] u32Size		block size.
  * @param[in] pcBlkName		block name, cannot be null.
  *
  *
@@ -519,7 +521,7 @@ IMP_VOID *IMP_System_GetBlock(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32
  *
  * @remarks
  *
- * @attention null.
+ * @attention pcPoolName can be NULL when u32PoolId is valid.
  */
 IMP_VOID *IMP_System_GetBlock_From_Tail(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32 u32Size, const char *pcBlkName);
 
@@ -550,7 +552,7 @@ IMP_S32 IMP_System_ReleaseBlock(IMP_U32 u32PoolId, IMP_VOID *pBlockVaddr);
  *
  *
  * @retval successful return the physics address of the block
- * @retval failure return IMP_NULL
+ * @retval failure return 0
  *
  * @remarks
  *
@@ -567,7 +569,7 @@ IMP_U32 IMP_System_Block2PhyAddr(IMP_VOID *pBlockVaddr);
  *
  *
  * @retval successful return the mempool ID
- * @retval failure return IMP_NULL
+ * @retval failure return 0
  *
  * @remarks
  *
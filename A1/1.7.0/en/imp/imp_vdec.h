@@ -151,7 +151,7 @@ typedef enum{
  */
 typedef struct{
 	IMP_U64		u64PhyAddr; /* physical address of user data */
-	IMP_U32		u32Len; /* user data lenght */
+	IMP_U32		u32Len; /* user data length */
 	IMP_BOOL	bValid; /* is valid? */
 	IMP_U8*		pu8Addr; /* virtual address of user data */
 } VDEC_USERDATA_S;
@@ -172,12 +172,12 @@ typedef struct{
  * The structure of software jpeg decoding
  */
 typedef struct{
-	IMP_U32			u32ImageWidth; /* image width */
-	IMP_U32			u32ImageHeight; /* image height */
-	PIXEL_FORMAT_E	enOutputFormat; /* output format,only support NV12、ARGB1555 */
-	IMP_U32			u32Len; /* jpeg picture lenght */
-	IMP_U8*			pu8SrcAddr; /* jpeg picture address */
-	IMP_U8*			pu8DstAddr; /* output picture address */
+	IMP_U32			u32ImageWidth; /* image width obtained by decoding */
+	IMP_U32			u32ImageHeight; /* image height obtained by decoding */
+	PIXEL_FORMAT_E	enOutputFormat; /* output format,only support NV12 and ARGB1555 */
+	IMP_U32			u32Len; /* jpeg picture length */
+	IMP_U8*			pu8SrcAddr; /* source address of the jpeg picture */
+	IMP_U8*			pu8DstAddr; /* destination address of the decoded picture */
 	IMP_VOID*		priv; /* private data used internally */
 } JPEGD_INSTANCE_S;
 
@@ -423,7 +423,7 @@ IMP_S32 IMP_VDEC_StopRecvStream(IMP_S32 s32DevId);
  *
  * @param[in] s32DevId Device id,range:[0, @ref NR_MAX_VDEC_DEV - 1]
  * @param[in] pstStream Pointer of stream data
- * @param[in] s32MilliSec sending methods
+ * @param[in] s32MilliSec Sending timeout(unit:ms)
  *
  * @retval 0 Success
  * @retval Non 0 Failure
@@ -431,7 +431,7 @@ IMP_S32 IMP_VDEC_StopRecvStream(IMP_S32 s32DevId);
  * @remarks Null.
  *
  * @attention Device must have been created and started reciving stream before sending stream.Otherwise,return failure.
- * @attention Stream must be sent according to the sending method.Otherwise,return failure.
+ * @attention Stream must be sent according to the sending method(enMode) set when creating the device.Otherwise,decoding errors occur.
  * @attention Send the bitstream in a non blocking way,and if the bitstream buffer is full, it will return IMP_EBUFFULL.
  * @attention Sending the stream in a timeout way,if the stream cannot be successfully sent after reaching the timeout time, it will return IMP_EBUFFULL.
  * @attention If the receiving stream is stopped during the sending process, the interface will return IMP_EPERM.
@@ -578,7 +578,7 @@ IMP_S32 IMP_VDEC_SetUserPic(IMP_S32 s32DevId, const FRAME_INFO_S *pstUsrPic);
 IMP_S32 IMP_VDEC_EnableUserPic(IMP_S32 s32DevId, IMP_BOOL bInstant);
 
 /**
- * @fn IMP_S32 IMP_VDEC_DisableUserPic(IMP_S32 s32DevId, IMP_BOOL bInstant)
+ * @fn IMP_S32 IMP_VDEC_DisableUserPic(IMP_S32 s32DevId)
  *
  * Disable user picture(this interface is currently not enabled)
  *
@@ -616,10 +616,10 @@ IMP_S32 IMP_VDEC_SetDisplayMode(IMP_S32 s32DevId, VIDEO_DISPLAY_MODE_E enDisplay
 /**
  * @fn IMP_S32 IMP_VDEC_GetDisplayMode(IMP_S32 s32DevId, VIDEO_DISPLAY_MODE_E *penDisplayMode)
  *
- * Set decoding device display mode
+ * Get decoding device display mode
  *
  * @param[in] s32DevId Device id,range:[0, @ref NR_MAX_VDEC_DEV - 1]
- * @param[in] penDisplayMode Pointer of display mode
+ * @param[out] penDisplayMode Pointer of display mode
  *
  * @retval 0 Success
  * @retval Non 0 Failure
@@ -725,7 +725,6 @@ IMP_S32 IMP_VDEC_AttachChnVbPool(IMP_S32 s32DevId, IMP_S32 s32ChnId, IMP_U32 u32
  *
  * @param[in] s32DevId Device id,range:[0, @ref NR_MAX_VDEC_DEV - 1]
  * @param[in] s32ChnId Channel id,range:[0, @ref NR_MAX_VDEC_CHN - 1]
- * @param[in] u32PoolId Video buffer pool id
  *
  * @retval 0 Success
  * @retval Non 0 Failure
@@ -878,14 +877,15 @@ IMP_S32 IMP_JPEGD_Init(JPEGD_INSTANCE_S *pstInstance);
  *
  * Start software jpeg decoding
  *
- * @param[in] pstInstance Pointer of jpeg decoding instance
+ * @param[in,out] pstInstance Pointer of jpeg decoding instance
  *
  * @retval =0 Success
  * @retval <0 Failure
  *
- * @remarks Null.
+ * @remarks u32Len, pu8SrcAddr, pu8DstAddr and enOutputFormat are set by the caller before decoding,
+ * u32ImageWidth and u32ImageHeight are filled in by the decoder.
  *
- * @attention Null.
+ * @attention The buffer at pu8DstAddr must be large enough to hold the decoded picture in enOutputFormat.
  */
 IMP_S32 IMP_JPEGD_Decode(JPEGD_INSTANCE_S *pstInstance);
 
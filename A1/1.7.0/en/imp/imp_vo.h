@@ -197,7 +197,7 @@ IMP_S32 IMP_VO_SetPubAttr(IMP_S32 s32VoMod,VO_PUB_ATTR_S *pstPubAttr);
  * Get the public attributes of the video output module.
  *
  * @param[in] s32VoMod Video output module ID.
- * @param[in] pstPubAttr Video output module public attributes.
+ * @param[out] pstPubAttr Video output module public attributes.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -247,7 +247,7 @@ IMP_S32 IMP_VO_Disable(IMP_S32 s32VoMod);
  * Get the HDMI/VGA status of the display interface on the video output module.
  *
  * @param[in] enDevIntf Interface.
- * @param[in] pstIntfStatus Interface status.
+ * @param[out] pstIntfStatus Interface status.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -325,7 +325,7 @@ IMP_S32 IMP_VO_SetVideoLayerAttr(IMP_S32 s32VoLayer,const VO_VIDEO_LAYER_ATTR_S
  * Get the video layer attributes.
  *
  * @param[in] s32VoLayer Video layer ID.
- * @param[in] pstLayerAttr The pointer of the video layer attributes.
+ * @param[out] pstLayerAttr The pointer of the video layer attributes.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -372,9 +372,9 @@ IMP_S32 IMP_VO_DisableVideoLayer(IMP_S32 s32VoLayer);
  * The structure of video channel attributes
  */
 typedef struct{
-    IMP_U32		u32Priority;
-    IMP_BOOL	bDeflicker;
-    IMP_RECT_S	stRect;
+    IMP_U32		u32Priority;	/**< Channel priority */
+    IMP_BOOL	bDeflicker;		/**< Whether to enable deflicker */
+    IMP_RECT_S	stRect;			/**< Display area of the channel on the video layer canvas */
 }VO_CHN_ATTR_S;
 
 /**
@@ -402,7 +402,7 @@ IMP_S32 IMP_VO_SetChnAttr(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,const VO_CHN_ATTR_
  *
  * @param[in] s32VoLayer Video layer ID.
  * @param[in] s32VoChn Video channel ID.
- * @param[in] pstChnAttr The pointer of video channel attributes.
+ * @param[out] pstChnAttr The pointer of video channel attributes.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -473,7 +473,7 @@ IMP_S32 IMP_VO_SetChnDispPos(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,const IMP_POINT
  *
  * @param[in] s32VoLayer Video layer ID.
  * @param[in] s32VoChn Video channel ID.
- * @param[in] pstPoint The pointer of position.
+ * @param[out] pstPoint The pointer of position.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -581,9 +581,9 @@ IMP_S32 IMP_VO_HideChn(IMP_S32 s32VoLayer,IMP_S32 s32VoChn);
  * @retval 0 success
  * @retval Non 0 Failure，For details, see the error code description.
  *
- * @remarks 无.
+ * @remarks Null.
  *
- * @attention 无.
+ * @attention Null.
  */
 IMP_S32 IMP_VO_HideChnPart(IMP_S32 s32VoLayer,IMP_S32 *pS32VoChnPart,IMP_S32 s32VoChnCnt);
 
@@ -607,7 +607,7 @@ IMP_S32 IMP_VO_HideChnAll(IMP_S32 s32VoLayer);
  * The structure of video channel zoom attributes
  */
 typedef struct{
-	IMP_RECT_S stZoomRect;
+	IMP_RECT_S stZoomRect;	/**< Region of the channel image to be zoomed in */
 }VO_ZOOM_ATTR_S;
 
 /**
@@ -635,7 +635,7 @@ IMP_S32 IMP_VO_SetZoomInWindow(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,VO_ZOOM_ATTR_
  *
  * @param[in] s32VoLayer Video layer ID.
  * @param[in] s32VoChn Video channel ID.
- * @param[in] stZoomAttr The pointer of zoom attributes.
+ * @param[out] stZoomAttr The pointer of zoom attributes.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
@@ -665,7 +665,7 @@ IMP_S32 IMP_VO_GetZoomInWindow(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,VO_ZOOM_ATTR_
 IMP_S32 IMP_VO_ClearChnBuffer(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_BOOL bClrAll);
 
 /**
- * @fn IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
+ * @fn IMP_S32 IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
  *
  * Get frame of the video channel.
  *
@@ -683,7 +683,7 @@ IMP_S32 IMP_VO_ClearChnBuffer(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_BOOL bClrA
 IMP_S32 IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame);
 
 /**
- * @fn IMP_VO_QueryChnDisplayFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
+ * @fn IMP_S32 IMP_VO_QueryChnDisplayFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
  *
  * Query the displaying frame of channel
  *
@@ -719,13 +719,13 @@ IMP_S32 IMP_VO_QueryChnDisplayFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_IN
 IMP_S32 IMP_VO_ReleaseChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S *pstFrame);
 
 /**
- * @fn IMP_VO_GetChnPts(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_U64 *u64Pts)
+ * @fn IMP_S32 IMP_VO_GetChnPts(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_U64 *u64Pts)
  *
  * Get the timestamp of the current channel display frame
  *
  * @param[in] s32VoLayer Video layer ID.
  * @param[in] s32VoChn Video channel ID.
- * @param[in] u64Pts The timestamp of the current channel display frame.
+ * @param[out] u64Pts The timestamp of the current channel display frame.
  *
  * @retval 0 Success
  * @retval Non 0 Failure，For details, see the error code description.
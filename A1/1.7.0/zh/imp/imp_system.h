@@ -370,9 +370,9 @@ IMP_S32 IMP_System_CloseFd(IMP_VOID);
  *
  * 在Rmem上创建mempool
  *
- * @param[in] pu32PoolId 	申请的缓存池ID存放地址.
+ * @param[out] pu32PoolId 	申请的缓存池ID存放地址.
  * @param[in] u32BlkSize	申请缓存池中每个缓存块大小,单位 bytes.
- * @param[in] u32BlkSize	申请缓存池中缓存块的个数.
+ * @param[in] u32BlkCnt	申请缓存池中缓存块的个数.
  * @param[in] pcPoolName	缓存池名字,不能为空.
  *
  * @retval IMP_SUCCESS 成功
@@ -395,9 +395,9 @@ IMP_S32 IMP_System_CreatPool(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_U32 u3
  *
  * 在Rmem上创建mempool,并从尾部开始创建
  *
- * @param[in] pu32PoolId 	申请的缓存池ID存放地址.
+ * @param[out] pu32PoolId 	申请的缓存池ID存放地址.
  * @param[in] u32BlkSize	申请缓存池中每个缓存块大小,单位 bytes.
- * @param[in] u32BlkSize	申请缓存池中缓存块的个数.
+ * @param[in] u32BlkCnt	申请缓存池中缓存块的个数.
  * @param[in] pcPoolName	缓存池名字,不能为空.
  *
  * @retval IMP_SUCCESS 成功
@@ -420,9 +420,9 @@ IMP_S32 IMP_System_CreatPool_From_Tail(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize,
  *
  * 在Rmem上创建mempool
  *
- * @param[in] pu32PoolId 	申请的缓存池ID存放地址.
+ * @param[out] pu32PoolId 	申请的缓存池ID存放地址.
  * @param[in] u32BlkSize	申请缓存池中每个缓存块大小,单位 bytes.
- * @param[in] u32BlkSize	申请缓存池中缓存块的个数.
+ * @param[in] u32BlkCnt	申请缓存池中缓存块的个数.
  * @param[in] pcPoolName	缓存池名字,不能为空.
  * @param[in] s32AlignWidth	内存池字节对齐数.
  *
@@ -446,9 +446,9 @@ IMP_S32 IMP_System_CreatPool_Align(IMP_U32 *pu32PoolId, IMP_U32 u32BlkSize, IMP_
  *
  * 在Rmem上创建mempool,并从尾部开始创建
  *
- * @param[in] pu32PoolId 	申请的缓存池ID存放地址.
+ * @param[out] pu32PoolId 	申请的缓存池ID存放地址.
  * @param[in] u32BlkSize	申请缓存池中每个缓存块大小,单位 bytes.
- * @param[in] u32BlkSize	申请缓存池中缓存块的个数.
+ * @param[in] u32BlkCnt	申请缓存池中缓存块的个数.
  * @param[in] pcPoolName	缓存池名字,不能为空.
  * @param[in] s32AlignWidth	内存池字节对齐数.
  *
@@ -472,7 +472,7 @@ IMP_S32 IMP_System_CreatPool_Align_From_Tail(IMP_U32 *pu32PoolId, IMP_U32 u32Blk
  *
  * 销毁Rmem上对应的 mempool
  *
- * @param[in] u32PoolId 	需要销毁的poolid，优先进行匹配，如果匹配成功，则忽略pcName.
+ * @param[in] u32PoolId 	需要销毁的poolid，优先进行匹配，如果匹配成功，则忽略pcPoolName.
  * @param[in] pcPoolName	需要销毁的pool名称, 在u32PoolId 无效时，进行匹配.
  *
  * @retval IMP_SUCCESS 成功
@@ -492,9 +492,9 @@ IMP_S32 IMP_System_DestroyPool(IMP_U32 u32PoolId, const char *pcPoolName);
  *
  * 从对应u32PoolId 或 pcPoolName中获取block对应地址空间
  *
- * @param[in] u32PoolId 	需要指定poolid，优先进行匹配，如果匹配成功，则忽略pciPoolName.
- * @param[in] pcName		pool的名称, 在u32PoolId 无效时，进行匹配，如果匹配成功，则从对应的pool中分配block.
- * @param[in] Size		 	申请block大小.
+ * @param[in] u32PoolId 	需要指定poolid，优先进行匹配，如果匹配成功，则忽略pcPoolName.
+ * @param[in] pcPoolName	pool的名称, 在u32PoolId 无效时，进行匹配，如果匹配成功，则从对应的pool中分配block.
+ * @param[in] u32Size		申请block大小.
  * @param[in] pcBlkName		申请block名字，不能为空.
  *
  *
@@ -503,7 +503,7 @@ IMP_S32 IMP_System_DestroyPool(IMP_U32 u32PoolId, const char *pcPoolName);
  *
  * @remarks
  *
- * @attention 确保u32PoolId有效的前提下，pcName 可以设置为NULL.
+ * @attention 确保u32PoolId有效的前提下，pcPoolName 可以设置为NULL.
  */
 IMP_VOID *IMP_System_GetBlock(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32 u32Size, const char *pcBlkName);
 
@@ -512,9 +512,9 @@ IMP_VOID *IMP_System_GetBlock(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32
  *
  * 从对应u32PoolId 或 pcPoolName中获取block对应地址空间,此接口从rmem后面剩余空间申请
  *
- * @param[in] u32PoolId 	需要指定poolid，优先进行匹配，如果匹配成功，则忽略pciPoolName.
- * @param[in] pcName		pool的名称, 在u32PoolId 无效时，进行匹配，如果匹配成功，则从对应的pool中分配block.
- * @param[in] Size		 	申请block大小.
+ * @param[in] u32PoolId 	需要指定poolid，优先进行匹配，如果匹配成功，则忽略pcPoolName.
+ * @param[in] pcPoolName	pool的名称, 在u32PoolId 无效时，进行匹配，如果匹配成功，则从对应的pool中分配block.
+ * @param[in] u32Size		申请block大小.
  * @param[in] pcBlkName		申请block名字，不能为空.
  *
  *
@@ -523,7 +523,7 @@ IMP_VOID *IMP_System_GetBlock(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32
  *
  * @remarks
  *
- * @attention 确保u32PoolId有效的前提下，pcName 可以设置为NULL.
+ * @attention 确保u32PoolId有效的前提下，pcPoolName 可以设置为NULL.
  */
 IMP_VOID *IMP_System_GetBlock_From_Tail(IMP_U32 u32PoolId, const char *pcPoolName, IMP_U32 u32Size, const char *pcBlkName);
 
@@ -424,7 +424,7 @@ IMP_S32 IMP_VDEC_StopRecvStream(IMP_S32 s32DevId);
  *
  * @param[in] s32DevId Device号,取值范围:[0, @ref NR_MAX_VDEC_DEV - 1]
  * @param[in] pstStream 解码码流数据指针
- * @param[in] s32MilliSec 送码流方式
+ * @param[in] s32MilliSec 送码流超时时间(单位:ms)
  *
  * @retval 0 成功
  * @retval 非0 失败
@@ -578,7 +578,7 @@ IMP_S32 IMP_VDEC_SetUserPic(IMP_S32 s32DevId, const FRAME_INFO_S *pstUsrPic);
 IMP_S32 IMP_VDEC_EnableUserPic(IMP_S32 s32DevId, IMP_BOOL bInstant);
 
 /**
- * @fn IMP_S32 IMP_VDEC_DisableUserPic(IMP_S32 s32DevId, IMP_BOOL bInstant)
+ * @fn IMP_S32 IMP_VDEC_DisableUserPic(IMP_S32 s32DevId)
  *
  * 禁止使能插入解码用户图片（该接口目前暂未启用）
  *
@@ -724,7 +724,6 @@ IMP_S32 IMP_VDEC_AttachChnVbPool(IMP_S32 s32DevId, IMP_S32 s32ChnId, IMP_U32 u32
  *
  * @param[in] s32DevId Device号,取值范围:[0, @ref NR_MAX_VDEC_DEV - 1]
  * @param[in] s32ChnId Channel号,取值范围:[0, @ref NR_MAX_VDEC_CHN - 1]
- * @param[in] u32PoolId 视频缓存池号
  *
  * @retval 0 成功
  * @retval 非0 失败
@@ -876,14 +875,15 @@ IMP_S32 IMP_JPEGD_Init(JPEGD_INSTANCE_S *pstInstance);
  *
  * 开始软件jpeg解码
  *
- * @param[in] pstInstance jpeg解码实例
+ * @param[in,out] pstInstance jpeg解码实例
  *
  * @retval =0 成功
  * @retval <0 失败
  *
- * @remarks 无。
+ * @remarks u32Len、pu8SrcAddr、pu8DstAddr和enOutputFormat由调用者在解码前设置，
+ * u32ImageWidth和u32ImageHeight由解码器填充。
  *
- * @attention 无。
+ * @attention pu8DstAddr指向的buffer必须足够存放按enOutputFormat输出的解码图像。
  */
 IMP_S32 IMP_JPEGD_Decode(JPEGD_INSTANCE_S *pstInstance);
 
@@ -196,7 +196,7 @@ IMP_S32 IMP_VO_SetPubAttr(IMP_S32 s32VoMod,VO_PUB_ATTR_S *pstPubAttr);
  * 获取视频输出模块公共属性.
  *
  * @param[in] s32VoMod 视频输出模块号.
- * @param[in] pstPubAttr 视频输出模块公共属性指针.
+ * @param[out] pstPubAttr 视频输出模块公共属性指针.
  *
  * @retval IMP_SUCCESS 成功
  * @retval 非IMP_SUCCESS 失败，具体原因参见错误码说明.
@@ -245,7 +245,7 @@ IMP_S32 IMP_VO_Disable(IMP_S32 s32VoMod);
  * 获取视频输出模块显示接口HDMI/VGA状态.
  *
  * @param[in] enDevIntf 设备接口.
- * @param[in] pstIntfStatus 接口状态.
+ * @param[out] pstIntfStatus 接口状态.
  *
  * @retval IMP_SUCCESS 成功
  * @retval 非IMP_SUCCESS 失败，具体原因参见错误码说明.
@@ -323,7 +323,7 @@ IMP_S32 IMP_VO_SetVideoLayerAttr(IMP_S32 s32VoLayer,const VO_VIDEO_LAYER_ATTR_S
  * 获取视频层属性.
  *
  * @param[in] s32VoLayer 视频层号.
- * @param[in] pstLayerAttr 视频层属性结构体指针.
+ * @param[out] pstLayerAttr 视频层属性结构体指针.
  *
  * @retval IMP_SUCCESS 成功
  * @retval 非IMP_SUCCESS 失败，具体原因参见错误码说明.
@@ -370,9 +370,9 @@ IMP_S32 IMP_VO_DisableVideoLayer(IMP_S32 s32VoLayer);
  * 视频通道属性结构体定义
  */
 typedef struct{
-    IMP_U32		u32Priority;
-    IMP_BOOL	bDeflicker;
-    IMP_RECT_S	stRect;
+    IMP_U32		u32Priority;	/**< 通道优先级 */
+    IMP_BOOL	bDeflicker;		/**< 是否使能抗闪烁 */
+    IMP_RECT_S	stRect;			/**< 通道在视频层画布上的显示区域 */
 }VO_CHN_ATTR_S;
 
 /**
@@ -400,7 +400,7 @@ IMP_S32 IMP_VO_SetChnAttr(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,const VO_CHN_ATTR_
  *
  * @param[in] s32VoLayer 视频层号.
  * @param[in] s32VoChn 视频通道号.
- * @param[in] pstChnAttr 视频输出通道属性结构体指针.
+ * @param[out] pstChnAttr 视频输出通道属性结构体指针.
  *
  * @retval IMP_SUCCESS 成功
  * @retval 非IMP_SUCCESS 失败，具体原因参见错误码说明.
@@ -470,7 +470,7 @@ IMP_S32 IMP_VO_SetChnDispPos(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,const IMP_POINT
  *
  * @param[in] s32VoLayer 视频层号.
  * @param[in] s32VoChn 视频通道号.
- * @param[in] pstPoint 通道显示位置指针.
+ * @param[out] pstPoint 通道显示位置指针.
  *
  * @retval IMP_SUCCESS 成功
  * @retval 非IMP_SUCCESS 失败，具体原因参见错误码说明.
@@ -604,7 +604,7 @@ IMP_S32 IMP_VO_HideChnAll(IMP_S32 s32VoLayer);
  * 视频输出局部放大结构体定义
  */
 typedef struct{
-	IMP_RECT_S stZoomRect;
+	IMP_RECT_S stZoomRect;	/**< 通道图像中需要放大的区域 */
 }VO_ZOOM_ATTR_S;
 
 /**
@@ -632,7 +632,7 @@ IMP_S32 IMP_VO_SetZoomInWindow(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,VO_ZOOM_ATTR_
  *
  * @param[in] s32VoLayer 视频层号.
  * @param[in] s32VoChn 视频通道号.
- * @param[in] stZoomAttr 局部放大属性结构体.
+ * @param[out] stZoomAttr 局部放大属性结构体.
  *
  * @retval IMP_SUCCESS 成功
  * @retval 非IMP_SUCCESS 失败，具体原因参见错误码说明.
@@ -662,7 +662,7 @@ IMP_S32 IMP_VO_GetZoomInWindow(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,VO_ZOOM_ATTR_
 IMP_S32 IMP_VO_ClearChnBuffer(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_BOOL bClrAll);
 
 /**
- * @fn IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
+ * @fn IMP_S32 IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
  *
  * 获取通道帧
  *
@@ -680,7 +680,7 @@ IMP_S32 IMP_VO_ClearChnBuffer(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_BOOL bClrA
 IMP_S32 IMP_VO_GetChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame);
 
 /**
- * @fn IMP_VO_QueryChnDisplayFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
+ * @fn IMP_S32 IMP_VO_QueryChnDisplayFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S **pstFrame)
  *
  * 查询通道正在显示帧
  *
@@ -716,13 +716,13 @@ IMP_S32 IMP_VO_QueryChnDisplayFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_IN
 IMP_S32 IMP_VO_ReleaseChnFrame(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,FRAME_INFO_S *pstFrame);
 
 /**
- * @fn IMP_VO_GetChnPts(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_U64 *u64Pts)
+ * @fn IMP_S32 IMP_VO_GetChnPts(IMP_S32 s32VoLayer,IMP_S32 s32VoChn,IMP_U64 *u64Pts)
  *
  * 获取当前通道显示帧的时间戳.
  *
  * @param[in] s32VoLayer 视频层号.
  * @param[in] s32VoChn 视频通道号.
- * @param[in] u64Pts 获取当前通道显示帧的时间戳指针.
+ * @param[out] u64Pts 获取当前通道显示帧的时间戳指针.
  *
  * @retval IMP_SUCCESS 成功
  * @retval 非IMP_SUCCESS 失败，具体原因参见错误码说明.
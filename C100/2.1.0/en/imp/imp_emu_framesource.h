@@ -1,5 +1,5 @@
 /*
- * IMP Encoder emulator header file.
+ * IMP FrameSource emulator header file.
  *
  * Copyright (C) 2014 Ingenic Semiconductor Co.,Ltd
  * Author: Zoro <yakun.li@ingenic.com>
@@ -10,12 +10,13 @@
 
 /**
  * @file
- * Encoder emulator func interface.
+ * FrameSource emulator func interface.
  */
 
 #include <stdint.h>
 #include <linux/videodev2.h>
 #include <imp/imp_common.h>
+#include <imp/imp_framesource.h>
 
 #ifdef __cplusplus
 #if __cplusplus
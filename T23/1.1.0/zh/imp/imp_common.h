@@ -64,7 +64,7 @@ typedef struct {
 	uint32_t virAddr;         /**< 帧的虚拟地址 */
 	uint32_t direct_phyAddr;  /**< 帧的直通地址 */
 
-	int64_t timeStamp;        /**< 帧的时间戳 */
+	int64_t timeStamp;        /**< 帧的时间戳，单位us，与IMP_System_GetTimeStamp时间基准相同 */
 	uint32_t priv[0];         /**< 私有数据 */
 } IMPFrameInfo;
 
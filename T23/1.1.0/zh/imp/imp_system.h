@@ -187,6 +187,7 @@ int IMP_System_Exit(void);
  * @retval 时间(usec)
  *
  * @remark 系统初始化后时间戳自动被初始化。系统去初始化后时间戳失效。
+ * @remark 帧的时间戳(IMPFrameInfo::timeStamp)和编码码流的时间戳使用相同的时间基准，可与该值直接比较。
  *
  * @attention 无。
  */
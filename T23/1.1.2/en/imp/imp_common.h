@@ -64,7 +64,7 @@ typedef struct {
 	uint32_t virAddr;        /**< frame's virtual address */
 	uint32_t direct_phyAddr; /**< frame's direct address */
 
-	int64_t timeStamp;       /**< frame time stamp*/
+	int64_t timeStamp;       /**< frame time stamp, unit us, same time base as IMP_System_GetTimeStamp */
 	int64_t timeStamp_ivdc;  /**< ivdc frame dq time stamp*/
 	uint32_t priv[0];        /**< private data */
 } IMPFrameInfo;
@@ -1862,22 +1862,26 @@ int IMP_ISP_Tuning_GetAfWeight(IMPISPWeight *af_weight);
 int IMP_ISP_Tuning_GetAfZone(IMPISPZone *af_zone);
 
 /**
- * ISP Wait Frame Params。
+ * ISP Wait Frame Params.
  */
 typedef struct {
-	uint32_t timeout;		/**< timeout，unit ms */
-	uint64_t cnt;			/**< Frame num */
+	uint32_t timeout;		/**< timeout, unit ms, set by the caller */
+	uint64_t cnt;			/**< Frame num, filled in on return */
 }IMPISPWaitFrameAttr;
 /**
  * @fn int IMP_ISP_Tuning_WaitFrame(IMPISPWaitFrameAttr *attr)
  * Wait frame done
  *
- * @param[out] attr frame done parameters
+ * @param[in,out] attr frame done parameters
  *
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
- * @attention Before using that function, make sure that ISP is working properly.
+ * @remarks Set timeout before the call, cnt holds the frame count when the function returns.
+ * @remarks To switch a group of parameters, e.g. on a day/night change, call the IMP_ISP_Tuning_Set* functions immediately after this function returns,
+ * to maximise the chance that they apply to the next frame. This function only waits for a frame boundary and does not guarantee it.
+ *
+ * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int IMP_ISP_Tuning_WaitFrame(IMPISPWaitFrameAttr *attr);
 
@@ -2588,47 +2592,46 @@ int32_t IMP_ISP_SetAeAlgoFunc(IMPISPAeAlgoFunc *ae_func);
 
 
 /**
- * 3th custom AWB library AWB init information
+ * 3th custom AWB library AWB information
  */
 typedef struct {
-	uint32_t cur_r_gain;						/* current awb r-gain*/
-	uint32_t cur_b_gain;						/* current awb b-gain*/
-	uint32_t r_gain_statis;						/* current awb r-gain of global statis info*/
-	uint32_t b_gain_statis;						/* current awb b-gain of global statis info*/
-	uint32_t r_gain_wei_statis;					/* current awb r-gain of global weighted statis info*/
-	uint32_t b_gain_wei_statis;					/* current awb b-gain of global weighted statis info*/
-	IMPISPAWBZone awb_statis;					/* current awb statis info for each zone*/
+	uint32_t cur_r_gain;						/**< current awb r-gain */
+	uint32_t cur_b_gain;						/**< current awb b-gain */
+	uint32_t r_gain_statis;						/**< current awb r-gain of global statis info */
+	uint32_t b_gain_statis;						/**< current awb b-gain of global statis info */
+	uint32_t r_gain_wei_statis;					/**< current awb r-gain of global weighted statis info */
+	uint32_t b_gain_wei_statis;					/**< current awb b-gain of global weighted statis info */
+	IMPISPAWBZone awb_statis;					/**< current awb statis info for each zone, 15 x 15 zones */
 }__attribute__((packed, aligned(1))) IMPISPAwbInfo;
 
 /**
  * 3th custom AWB library AWB attribution
  */
 typedef struct {
-	uint32_t change;					/* change awb attribution or not*/
-	uint32_t r_gain;					/* awb attribution of r-gain*/
-	uint32_t b_gain;					/* awb attribution of b-gain*/
-	uint32_t ct;						/* awb color temp*/
+	uint32_t change;					/**< change awb attribution or not */
+	uint32_t r_gain;					/**< awb attribution of r-gain */
+	uint32_t b_gain;					/**< awb attribution of b-gain */
+	uint32_t ct;						/**< awb color temp */
 } IMPISPAwbAttr;
 
 /**
  * 3th custom AWB library AWB notify attribution
  */
 typedef enum {
-	IMPISP_AWB_NOTIFY_MODE_CHANGE,
+	IMPISP_AWB_NOTIFY_MODE_CHANGE,                        /**< Current AWB mode change */
 } IMPISPAwbNotify;
 
 /**
  * 3th custom AWB library callback functions
  */
 typedef struct {
-	void *priv_data;									/* private data addr*/
-	int (*open)(void *priv_data);								/* AWB open function for 3th custom library*/
-	void (*close)(void *priv_data);								/* AWB close function for 3th custom library*/
-	void (*handle)(void *priv_data, const IMPISPAwbInfo *AwbInfo, IMPISPAwbAttr *AwbAttr);	/* AWB handle function for 3th custom library*/
-	int (*notify)(void *priv_data, IMPISPAwbNotify notify, void *data);			/* AWB notify function for 3th custom library*/
+	void *priv_data;									/**< private data addr */
+	int (*open)(void *priv_data);								/**< AWB open function for 3th custom library */
+	void (*close)(void *priv_data);								/**< AWB close function for 3th custom library */
+	void (*handle)(void *priv_data, const IMPISPAwbInfo *AwbInfo, IMPISPAwbAttr *AwbAttr);	/**< AWB handle function for 3th custom library */
+	int (*notify)(void *priv_data, IMPISPAwbNotify notify, void *data);			/**< AWB notify function for 3th custom library */
 } IMPISPAwbAlgoFunc;
 
-int32_t IMP_ISP_SetAwbAlgoFunc(IMPISPAwbAlgoFunc *awb_func);
 /**
  * @fn int32_t IMP_ISP_SetAwbAlgoFunc(IMPISPAwbAlgoFunc *awb_func)
  *
@@ -2639,8 +2642,9 @@ int32_t IMP_ISP_SetAwbAlgoFunc(IMPISPAwbAlgoFunc *awb_func);
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
- * @attention Before using that function, make sure that IMP_ISP_AddSensor have be called.
+ * @attention This function must be called immediately after IMP_ISP_AddSensor.
  */
+int32_t IMP_ISP_SetAwbAlgoFunc(IMPISPAwbAlgoFunc *awb_func);
 
 /**
  * black level attr
@@ -4597,12 +4601,16 @@ int IMP_ISP_Tuning_GetAfZone_Sec(IMPISPZone *af_zone);
  * @fn int IMP_ISP_Tuning_WaitFrame_Sec(IMPISPWaitFrameAttr *attr)
  * Wait frame done
  *
- * @param[out] attr frame done parameters
+ * @param[in,out] attr frame done parameters
  *
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
- * @attention Before using that function, make sure that ISP is working properly.
+ * @remarks Set timeout before the call, cnt holds the frame count when the function returns.
+ * @remarks To switch a group of parameters, e.g. on a day/night change, call the IMP_ISP_Tuning_Set* functions immediately after this function returns,
+ * to maximise the chance that they apply to the next frame. This function only waits for a frame boundary and does not guarantee it.
+ *
+ * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int IMP_ISP_Tuning_WaitFrame_Sec(IMPISPWaitFrameAttr *attr);
 
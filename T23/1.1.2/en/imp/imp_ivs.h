@@ -35,7 +35,8 @@ extern "C"
  *
  * For a channel to be an algorithm that can run the carrier, the Channel has to be into the SDK. To do so, we need to transmit the specific implementation of the general algorithm to the specific interface of this Channel.
  *
- * IMPIVSInterface member parameter is the init member parameter, it is a must to include int (*free_data)(void *data) member, and assigned to IMP_IVS_ReleaseDa in order to avoid a lock (out).
+ * The IMPIVSInterface member param is the parameter of the member function init. \n
+ * IMP_IVS locks the frame passed to the member function processAsync, processAsync must call IMP_IVS_ReleaseData to release the frame once it is done with it, otherwise a deadlock occurs.
  *
  *
  * @section ivs_usage 2 Using method
@@ -140,13 +141,13 @@ struct IMPIVSInterface {
 	IMPPixelFormat pixfmt;										/**< input pixel format */
 	int  (*init)(IMPIVSInterface *inf);							/**< init algorithm func */
 	void (*exit)(IMPIVSInterface *inf);							/**< exit algorithm func */
-	int  (*preProcessSync)(IMPIVSInterface *inf, IMPFrameInfo *frame);/**< algorithm preprocess func, it's parameter frame hasn't been special locked by SDK IVS module, so no need to unlock by using free date, return >=0-> ok，-1->error */
-	int  (*processAsync)(IMPIVSInterface *inf, IMPFrameInfo *frame);/**< algorithm process func, should be sure unused frames must be unlocked by using free data asap, must be realized for it's a key func to generate algorithm result, return 0->nomal，1->skip check，-1->error */
+	int  (*preProcessSync)(IMPIVSInterface *inf, IMPFrameInfo *frame);/**< algorithm preprocess func, the frame passed in is not additionally locked by the SDK IVS module, so it does not need to be released, return >=0->ok, <0->error */
+	int  (*processAsync)(IMPIVSInterface *inf, IMPFrameInfo *frame);/**< algorithm process func, the frame passed in is additionally locked by the SDK IVS module, so it must be released with IMP_IVS_ReleaseData as soon as it is no longer used; this func must be implemented since it generates the algorithm result, return 0->detected normally, 1->frame skipped normally, -1->error */
 	int  (*getResult)(IMPIVSInterface *inf, void **result);		/**< get algorithm result */
 	int  (*releaseResult)(IMPIVSInterface *inf, void *result);	/**< release algorithm result */
 	int	 (*getParam)(IMPIVSInterface *inf, void *param);		/**< get algorithm parameter */
 	int	 (*setParam)(IMPIVSInterface *inf, void *param);		/**< set algorithm parameter */
-	int	 (*flushFrame)(IMPIVSInterface *inf);					/**< Released all frame which got and cached by processAsync */
+	int	 (*flushFrame)(IMPIVSInterface *inf);					/**< release all frames passed in through processAsync and cached by the algorithm */
 	void *priv;													/**< private info */
 };
 
@@ -302,14 +303,15 @@ int IMP_IVS_ReleaseResult(int ChnNum, void *result);
 /**
  * @fn int IMP_IVS_ReleaseData(void *vaddr);
  *
- * Release IVS function to calculate the resources result
+ * Release the frame passed to processAsync
  *
  * @param[in] vaddr the released frame's virtual address
  *
  * @retval 0 success
- * @retval 1 failed
+ * @retval -1 failed
  *
- * @remarks if libimp is used, it is a must to use the free_data of IVS function.
+ * @remarks The frame passed to processAsync must be released with this function, otherwise a deadlock occurs.
+ * @remarks This function is only for algorithm providers, users of an algorithm do not need to care about it.
  */
 int IMP_IVS_ReleaseData(void *vaddr);
 
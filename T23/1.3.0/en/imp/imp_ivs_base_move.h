@@ -1,5 +1,5 @@
 /*
- * IMP IVS Move func header file.
+ * IMP IVS Base Move func header file.
  *
  * Copyright (C) 2016 Ingenic Semiconductor Co.,Ltd
  */
@@ -34,10 +34,10 @@ extern "C"
  * Base Motion detection algorithm input parameter structure
  */
 typedef struct {
-	int             skipFrameCnt;                      /*< motion detected interval frame numbers */
-	int             referenceNum;                      /*specified the referenceNum frame relative to current frame as reference frame*/
-	int             sadMode;                           /*<SAD mode, 0 signify 8**/
-	int             sense;                             /*Sensitivity of motion detection:range:0-3, The bigger the value, the more sensitive*/
+	int             skipFrameCnt;                      /**< motion detected interval frame numbers */
+	int             referenceNum;                      /**< specified the referenceNum frame relative to current frame as reference frame */
+	int             sadMode;                           /**< SAD mode, 0 means 8*8 */
+	int             sense;                             /**< Sensitivity of motion detection, range: 0-3, the bigger the value, the more sensitive */
 	IMPFrameInfo    frameInfo;                         /**< frame information, only need to assign width and height */
 
 } IMP_IVS_BaseMoveParam;
@@ -49,7 +49,7 @@ typedef struct {
 	int ret;
 	uint8_t* data;
 	int datalen;
-	int64_t timeStamp;
+	int64_t timeStamp;	/**< Frame timestamp */
 } IMP_IVS_BaseMoveOutput;
 
 /**
@@ -84,4 +84,4 @@ void IMP_IVS_DestroyBaseMoveInterface(IMPIVSInterface *moveInterface);
 }
 #endif
 #endif /* __cplusplus */
-#endif /* __IMP_IVS_MOVE_H__ */
+#endif /* __IMP_IVS_BASE_MOVE_H__ */
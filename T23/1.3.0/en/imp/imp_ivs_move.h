@@ -35,17 +35,18 @@ extern "C"
  */
 typedef struct {
 	int				sense[IMP_IVS_MOVE_MAX_ROI_CNT];  /**< Sensitivity of motion detection: the range to normal camera is 0-4, while to Panoramic camera is 0-8 */
-	int				skipFrameCnt;					  /*< motion detected interval frame numbers */
+	int				skipFrameCnt;					  /**< motion detected interval frame numbers */
 	IMPFrameInfo	frameInfo;						  /**< frame information, only need to assign width and height */
-	IMPRect			roiRect[IMP_IVS_MOVE_MAX_ROI_CNT];/*< detect region  of information */
-	int				roiRectCnt;						  /*< detect region information counts */
+	IMPRect			roiRect[IMP_IVS_MOVE_MAX_ROI_CNT];/**< coordinates of the ROI regions to detect */
+	int				roiRectCnt;						  /**< number of ROI regions to detect, range: 0-51. 0: no detection, 1: detect roiRect 0,
+													   2: detect roiRect 0,1, 3: detect roiRect 0,1,2, and so on */
 } IMP_IVS_MoveParam;
 
 /*
  * Motion detection algorithm output parameter structure
  */
 typedef struct {
-	int retRoi[IMP_IVS_MOVE_MAX_ROI_CNT];			/*< region checkout result, 0:no motion, 1:move, region count equals to roiRectCnt */
+	int retRoi[IMP_IVS_MOVE_MAX_ROI_CNT];			/**< region checkout result, strictly corresponds to roiRect, 0:no motion, 1:move, region count equals to roiRectCnt */
 } IMP_IVS_MoveOutput;
 
 /**
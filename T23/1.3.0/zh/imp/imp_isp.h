@@ -1830,19 +1830,23 @@ int IMP_ISP_Tuning_GetAfZone(IMPISPZone *af_zone);
  * ISP Wait Frame 参数。
  */
 typedef struct {
-	uint32_t timeout;		/**< 超时时间，单位ms */
-	uint64_t cnt;			/**< Frame统计 */
+	uint32_t timeout;		/**< 超时时间，单位ms，由调用者设置 */
+	uint64_t cnt;			/**< Frame统计，函数返回时填充 */
 }IMPISPWaitFrameAttr;
 
 /**
 * @fn int IMP_ISP_Tuning_WaitFrame(IMPISPWaitFrameAttr *attr)
 * 等待帧结束
 *
-* @param[out] attr 等待帧结束属性
+* @param[in,out] attr 等待帧结束属性
 *
 * @retval 0 成功
 * @retval 非0 失败，返回错误码
 *
+* @remarks 调用前设置timeout，函数返回时cnt为帧计数。
+* @remarks 需要切换一组参数时（如日夜切换），建议在本函数返回后立即调用IMP_ISP_Tuning_Set*系列接口，
+* 以尽量使这些参数在下一帧生效。本函数只等待帧结束，并不保证参数在同一帧生效。
+*
 * @attention 在使用这个函数之前，IMP_ISP_EnableTuning已被调用。
 */
 int IMP_ISP_Tuning_WaitFrame(IMPISPWaitFrameAttr *attr);
@@ -2565,7 +2569,7 @@ typedef struct {
 	uint32_t cur_r_gain;								/**< 白平衡R通道增益 */
 	uint32_t cur_b_gain;								/**< 白平衡B通道增益 */
 	uint32_t r_gain_statis;								/**< 白平衡全局统计值r_gain */
-	uint32_t b_gain_statis;								/**< 白平衡全局加权统计值b_gain */
+	uint32_t b_gain_statis;								/**< 白平衡全局统计值b_gain */
 	uint32_t r_gain_wei_statis;							/**< 白平衡全局加权统计值r_gain */
 	uint32_t b_gain_wei_statis;							/**< 白平衡全局加权统计值b_gain */
 	IMPISPAWBZone awb_statis;						/**< 白平衡区域统计值 */
@@ -4513,11 +4517,15 @@ int IMP_ISP_Tuning_GetAfZone_Sec(IMPISPZone *af_zone);
 * @fn int IMP_ISP_Tuning_WaitFrame_Sec(IMPISPWaitFrameAttr *attr)
 * 等待帧结束
 *
-* @param[out] attr 等待帧结束属性
+* @param[in,out] attr 等待帧结束属性
 *
 * @retval 0 成功
 * @retval 非0 失败，返回错误码
 *
+* @remarks 调用前设置timeout，函数返回时cnt为帧计数。
+* @remarks 需要切换一组参数时（如日夜切换），建议在本函数返回后立即调用IMP_ISP_Tuning_Set*系列接口，
+* 以尽量使这些参数在下一帧生效。本函数只等待帧结束，并不保证参数在同一帧生效。
+*
 * @attention 在使用这个函数之前，IMP_ISP_EnableTuning已被调用。
 */
 int IMP_ISP_Tuning_WaitFrame_Sec(IMPISPWaitFrameAttr *attr);
@@ -6996,11 +7004,15 @@ int IMP_ISP_MultiCamera_Tuning_GetAfZone(IMPVI_NUM num, IMPISPZone *af_zone);
 * 等待帧结束
 *
  * @param[in] num   对应sensor的标号
-* @param[out] attr 等待帧结束属性
+* @param[in,out] attr 等待帧结束属性
 *
 * @retval 0 成功
 * @retval 非0 失败，返回错误码
 *
+* @remarks 调用前设置timeout，函数返回时cnt为帧计数。
+* @remarks 需要切换一组参数时（如日夜切换），建议在本函数返回后立即调用IMP_ISP_Tuning_Set*系列接口，
+* 以尽量使这些参数在下一帧生效。本函数只等待帧结束，并不保证参数在同一帧生效。
+*
 * @attention 在使用这个函数之前，IMP_ISP_EnableTuning已被调用。
 */
 int IMP_ISP_MultiCamera_Tuning_WaitFrame(IMPVI_NUM num, IMPISPWaitFrameAttr *attr);
@@ -125,7 +125,7 @@ typedef struct {
 	int64_t	timestamp;						/**< 时间戳，单位us */
 	bool	frameEnd;						/**< 帧结束标识 */
 	IMPEncoderNalType   nalType;				/**< H.264和H.265编码Channel码流NAL类型 */
-	IMPEncoderSliceType sliceType;
+	IMPEncoderSliceType sliceType;				/**< 码流包的slice类型，仅对slice类型的NAL有效 */
 } IMPEncoderPack;
 
 /**
@@ -218,20 +218,26 @@ typedef struct {
   IMPEncoderCropCfg       crop;           /**< 编码器裁剪属性 */
 } IMPEncoderEncAttr;
 
+/**
+ * 定义编码GOP控制模式
+ */
 typedef enum {
-  IMP_ENC_GOP_CTRL_MODE_DEFAULT       = 0x02,
-  IMP_ENC_GOP_CTRL_MODE_PYRAMIDAL     = 0x04,
+  IMP_ENC_GOP_CTRL_MODE_DEFAULT       = 0x02, /**< 默认GOP结构 */
+  IMP_ENC_GOP_CTRL_MODE_PYRAMIDAL     = 0x04, /**< 金字塔GOP结构 */
   IMP_ENC_GOP_CTRL_MAX_ENUM           = 0xff,
 } IMPEncoderGopCtrlMode;
 
+/**
+ * 定义编码通道GOP属性
+ */
 typedef struct {
-  IMPEncoderGopCtrlMode   uGopCtrlMode;
-  uint16_t                uGopLength;
-  uint8_t                 uNumB;
-  uint32_t                uMaxSameSenceCnt;
-  bool                    bEnableLT;
-  uint32_t                uFreqLT;
-  bool                    bLTRC;
+  IMPEncoderGopCtrlMode   uGopCtrlMode;     /**< GOP控制模式 */
+  uint16_t                uGopLength;       /**< GOP长度 */
+  uint8_t                 uNumB;            /**< 两个P帧之间的B帧个数 */
+  uint32_t                uMaxSameSenceCnt; /**< GOPLength = uGopLength * uMaxSameSenceCnt，默认为2 */
+  bool                    bEnableLT;        /**< 使能长期参考帧 */
+  uint32_t                uFreqLT;          /**< 长期参考帧频率 */
+  bool                    bLTRC;            /**< LTRC使能 */
 } IMPEncoderGopAttr;
 
 typedef enum {
@@ -530,6 +536,8 @@ int IMP_Encoder_Query(int encChn, IMPEncoderChnStat *stat);
  * 及时而导致的码流 buffer 满,停止编码。
  * @remarks 对于H264和H265类型码流，一次调用成功获取一帧的码流，这帧码流可能包含多个包。
  * @remarks 对于JPEG类型码流，一次调用成功获取一帧的码流，这帧码流只包含一个包，这一帧包含了JPEG图片文件的完整信息。
+ * @remarks 一帧码流的各个包位于以virAddr为起始、大小为streamSize的环形缓冲区中，pack.offset为相对virAddr的偏移，
+ * 包的数据可能跨越缓冲区末尾回绕到virAddr处，详见下面示例。
  *
  * 示例：
  * @code
@@ -549,11 +557,25 @@ int IMP_Encoder_Query(int encChn, IMPEncoderChnStat *stat);
  *
  * int i, nr_pack = stream.packCount;
  * for (i = 0; i < nr_pack; i++) { //保存这一帧码流的每个包
- *     ret = write(stream_fd, (void *)stream.pack[i].virAddr,
- *                stream.pack[i].length);
- *     if (ret != stream.pack[i].length) {
- *         printf("stream write error:%s\n", strerror(errno));
- *         return -1;
+ *     IMPEncoderPack *pack = &stream.pack[i];
+ *     uint32_t remSize = stream.streamSize - pack->offset;
+ *     if (remSize < pack->length) { //码流包跨越缓冲区末尾，分两段保存
+ *         ret = write(stream_fd, (void *)(stream.virAddr + pack->offset), remSize);
+ *         if (ret != remSize) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
+ *         ret = write(stream_fd, (void *)stream.virAddr, pack->length - remSize);
+ *         if (ret != pack->length - remSize) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
+ *     } else {
+ *         ret = write(stream_fd, (void *)(stream.virAddr + pack->offset), pack->length);
+ *         if (ret != pack->length) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
  *     }
  * }
  * @endcode
@@ -634,6 +656,38 @@ int IMP_Encoder_PollingModuleStream(uint32_t *encChnBitmap, uint32_t timeoutMsec
  * @remarks 在使用IMP_Encoder_PollingStream不合适的场合，比如在同一个地方Polling多个编码channel的编码完成情况时,
  * 可以使用此文件句柄调用select, poll等类似函数来阻塞等待编码完成事件
  * @remarks 调用此API需要通道已经存在
+ * @remarks 有码流可取时该文件句柄可读(POLLIN)，此时以非阻塞方式调用IMP_Encoder_GetStream即可取得码流。
+ *
+ * 示例：
+ * @code
+ * struct pollfd pfd[2];
+ * int chn[2] = {0, 1};
+ * int i;
+ *
+ * for (i = 0; i < 2; i++) {
+ *     pfd[i].fd = IMP_Encoder_GetFd(chn[i]);
+ *     pfd[i].events = POLLIN;
+ * }
+ *
+ * while (1) { //同时等待多个编码Channel
+ *     int ret = poll(pfd, 2, 1000);
+ *     if (ret < 0) {
+ *         if (errno == EINTR)
+ *             continue;
+ *         printf("poll error:%s\n", strerror(errno));
+ *         return -1;
+ *     }
+ *     for (i = 0; i < 2; i++) {
+ *         IMPEncoderStream stream;
+ *         if (!(pfd[i].revents & POLLIN))
+ *             continue;
+ *         if (IMP_Encoder_GetStream(chn[i], &stream, 0) < 0) //码流已就绪，非阻塞获取
+ *             continue;
+ *         ...... //处理码流
+ *         IMP_Encoder_ReleaseStream(chn[i], &stream);
+ *     }
+ * }
+ * @endcode
  *
  * @attention 无
  */
@@ -776,8 +830,39 @@ int IMP_Encoder_GetChnFrmRate(int encChn, IMPEncoderFrmRate *pstFps);
  */
 int IMP_Encoder_SetChnFrmRate(int encChn, const IMPEncoderFrmRate *pstFps);
 
+/**
+ * @fn int IMP_Encoder_SetChnBitRate(int encChn, int iTargetBitRate, int iMaxBitRate)
+ *
+ * 动态设置码率控制属性
+ *
+ * @param[in] encChn 编码Channel号,取值范围: [0, @ref NR_MAX_ENC_CHN - 1]
+ * @param[in] iTargetBitRate 目标码率，单位是:"bit/s"。
+ * @param[in] iMaxBitRate 最大码率，单位是:"bit/s"。
+ *
+ * @retval 0 成功
+ * @retval 非0 失败
+ *
+ * @remarks 调用此API会重新设置编码器码率属性，码率属性在下一个GOP生效，最大延时1秒钟生效，调用此API需要通道已经存在。
+ *
+ * @attention 此API只适用于H264和h265编码channel
+ */
 int IMP_Encoder_SetChnBitRate(int encChn, int iTargetBitRate, int iMaxBitRate);
 
+/**
+ * @fn int IMP_Encoder_SetChnGopLength(int encChn, int iGopLength);
+ *
+ * 设置编码通道GopLength属性
+ *
+ * @param[in] encChn 编码Channel号,取值范围: [0, @ref NR_MAX_ENC_CHN - 1]
+ * @param[in] iGopLength 编码GOP长度,单位为帧
+ *
+ * @retval 0 成功
+ * @retval 非0 失败
+ *
+ * @remarks 调用此API需要通道已经存在。
+ *
+ * @attention 此API只适用于H264和h265编码channel
+ */
 int IMP_Encoder_SetChnGopLength(int encChn, int iGopLength);
 
 /**
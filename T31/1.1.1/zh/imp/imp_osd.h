@@ -34,7 +34,7 @@ extern "C"
  * Region即是叠加区域，在API中简称Rgn。每个Region具有一定的图像信息，可以经过OSD模块叠加后，与背景图像合为一张图片。
  * 对于图片的叠加，还可以实现Alpha效果。关于各种叠加类型的详细介绍请参考@ref osd_region_type。
  *
- * @subsection osd_region_type 2.1 Region type
+ * @subsection osd_region_type 2.2 Region type
  * Region有几种类型，分别为：\n
  * OSD_REG_LINE：直线\n
  * OSD_REG_RECT：矩形框\n
@@ -152,7 +152,7 @@ typedef struct {
 	IMPPoint			offPos;			/**< 显示起始坐标 */
 	float				scalex;			/**< 缩放x参数 */
 	float				scaley;			/**< 缩放y参数 */
-	int					gAlphaEn;		/**< Alpha开关 */
+	int					gAlphaEn;		/**< Alpha开关，0：关闭，1：打开 */
 	int					fgAlhpa;		/**< 前景Alpha */
 	int					bgAlhpa;		/**< 背景Alpha */
 	int					layer;			/**< 显示层 */
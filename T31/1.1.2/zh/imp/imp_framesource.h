@@ -505,7 +505,7 @@ int IMP_FrameSource_SetChnFifoAttr(int chnNum, IMPFSChnFifoAttr *attr);
 int IMP_FrameSource_GetChnFifoAttr(int chnNum, IMPFSChnFifoAttr *attr);
 
 /**
- * @brief IMP_FrameSource_SetPool(int chnNum, int poolID);
+ * @fn int IMP_FrameSource_SetPool(int chnNum, int poolID);
  *
  * 绑定chnnel 到内存池中，即FrameSource申请mem从pool申请.
  *
@@ -524,7 +524,7 @@ int IMP_FrameSource_GetChnFifoAttr(int chnNum, IMPFSChnFifoAttr *attr);
 int IMP_FrameSource_SetPool(int chnNum, int poolID);
 
 /**
- * @brief IMP_FrameSource_GetPool(int chnNum);
+ * @fn int IMP_FrameSource_GetPool(int chnNum);
  *
  * 通过channel ID 获取poolID.
  *
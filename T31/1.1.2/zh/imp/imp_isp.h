@@ -1470,7 +1470,7 @@ typedef struct {
 	unsigned short af_hilight_th;    /**< AF高亮点统计阈值 [0 ~ 255]*/
 	unsigned short af_alpha_alt;    /**< AF统计低通滤波器的水平与垂直方向的权重 [0 ~ 64]*/
 	unsigned char  af_hstart;    /**< AF统计值横向起始点：[1-width]，且取奇数*/
-	unsigned char  af_vstart;    /**< AF统计值垂直起始点 ：[3-height]，且取奇数
+	unsigned char  af_vstart;    /**< AF统计值垂直起始点 ：[3-height]，且取奇数*/
 	unsigned char  af_stat_nodeh;    /**< 水平方向统计区域个数 [1 ~ 15]，整个画幅的统计窗口H数目 */
 	unsigned char  af_stat_nodev;    /**< 垂直方向统计区域个数 [1 ~ 15]，整个画幅的统计窗口V数目 */
 } IMPISPAFHist;
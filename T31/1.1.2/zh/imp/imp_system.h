@@ -187,6 +187,7 @@ int IMP_System_Exit(void);
  * @retval 时间(usec)
  *
  * @remarks 系统初始化后时间戳自动被初始化。系统去初始化后时间戳失效。
+ * @remarks 帧的时间戳(IMPFrameInfo::timeStamp)和编码码流的时间戳使用相同的时间基准，可与该值直接比较。
  *
  * @attention 无。
  */
@@ -327,7 +328,7 @@ int IMP_System_UnBind(IMPCell *srcCell, IMPCell *dstCell);
 int IMP_System_GetBindbyDest(IMPCell *dstCell, IMPCell *srcCell);
 
 /**
- * @brief IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
+ * @fn int IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
  *
  * 在Rmem上申请mempool
  *
@@ -2504,7 +2504,7 @@ typedef struct {
 	uint32_t cur_r_gain;								/**< 白平衡R通道增益 */
 	uint32_t cur_b_gain;								/**< 白平衡B通道增益 */
 	uint32_t r_gain_statis;								/**< 白平衡全局统计值r_gain */
-	uint32_t b_gain_statis;								/**< 白平衡全局加权统计值b_gain */
+	uint32_t b_gain_statis;								/**< 白平衡全局统计值b_gain */
 	uint32_t r_gain_wei_statis;							/**< 白平衡全局加权统计值r_gain */
 	uint32_t b_gain_wei_statis;							/**< 白平衡全局加权统计值b_gain */
 	IMPISPAWBZone awb_statis;						/**< 白平衡区域统计值 */
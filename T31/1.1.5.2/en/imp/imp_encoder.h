@@ -57,14 +57,14 @@ extern "C"
  */
 typedef enum {
 	IMP_H264_NAL_UNKNOWN		= 0,	/**< Undefined */
-	IMP_H264_NAL_SLICE		    = 1,	/**< A encoding strip for non IDR image */
-	IMP_H264_NAL_SLICE_DPA	    = 2,	/**< Encoding stripe data partition block A */
-	IMP_H264_NAL_SLICE_DPB	    = 3,	/**< Encoding stripe data partition block B */
-	IMP_H264_NAL_SLICE_DPC	    = 4,	/**< Encoding stripe data partition block C */
-	IMP_H264_NAL_SLICE_IDR	    = 5,	/**< Encoding strip of IDR image */
+	IMP_H264_NAL_SLICE		    = 1,	/**< Coded slice of a non-IDR picture */
+	IMP_H264_NAL_SLICE_DPA	    = 2,	/**< Coded slice data partition A */
+	IMP_H264_NAL_SLICE_DPB	    = 3,	/**< Coded slice data partition B */
+	IMP_H264_NAL_SLICE_DPC	    = 4,	/**< Coded slice data partition C */
+	IMP_H264_NAL_SLICE_IDR	    = 5,	/**< Coded slice of an IDR picture */
 	IMP_H264_NAL_SEI			= 6,	/**< SEI(Supplemental Enhancement Information) */
-	IMP_H264_NAL_SPS			= 7,	/**< SPS(Sequence Paramater Set) */
-	IMP_H264_NAL_PPS			= 8,	/**< PPS(Picture Paramater Set) */
+	IMP_H264_NAL_SPS			= 7,	/**< SPS(Sequence Parameter Set) */
+	IMP_H264_NAL_PPS			= 8,	/**< PPS(Picture Parameter Set) */
 	IMP_H264_NAL_AUD			= 9,	/**< Access unit separator */
 	IMP_H264_NAL_FILLER		    = 12,	/**< Fill in data */
 } IMPEncoderH264NaluType;
@@ -90,8 +90,8 @@ typedef enum {
     IMP_H265_NAL_SLICE_IDR_N_LP     = 20,       /**< Instant decoding refresh without front image */
     IMP_H265_NAL_SLICE_CRA          = 21,       /**< Pure random access with front image	*/
     IMP_H265_NAL_VPS                = 32,       /**< Video Parameter Set */
-    IMP_H265_NAL_SPS                = 33,       /**< SPS(Sequence Paramater Set) */
-    IMP_H265_NAL_PPS                = 34,       /**< PPS(Picture Paramater Set) */
+    IMP_H265_NAL_SPS                = 33,       /**< SPS(Sequence Parameter Set) */
+    IMP_H265_NAL_PPS                = 34,       /**< PPS(Picture Parameter Set) */
     IMP_H265_NAL_AUD                = 35,       /**< Access unit separator */
     IMP_H265_NAL_EOS                = 36,       /**< End of sequence */
     IMP_H265_NAL_EOB                = 37,       /**< End of bitstream */
@@ -130,8 +130,8 @@ typedef struct {
 	uint32_t	length;						/**< Stream packet length */
 	int64_t	timestamp;						/**< Time stamp, unit us */
 	bool	frameEnd;						/**< End of frame flag */
-	IMPEncoderNalType   nalType;			/**< Nal type of encoder channel */
-	IMPEncoderSliceType sliceType;          /**< Nal type of encoder slice */
+	IMPEncoderNalType   nalType;			/**< NAL unit type of the packet, use h264NalType or h265NalType according to the channel's protocol */
+	IMPEncoderSliceType sliceType;          /**< Slice type of the packet, only meaningful for coded slice NAL units */
 } IMPEncoderPack;
 
 /**
@@ -224,87 +224,114 @@ typedef struct {
   IMPEncoderCropCfg       crop;           /**< Encoder croping properties */
 } IMPEncoderEncAttr;
 
+/**
+ * Define the GOP control mode
+ */
 typedef enum {
-  IMP_ENC_GOP_CTRL_MODE_DEFAULT       = 0x02,
-  IMP_ENC_GOP_CTRL_MODE_PYRAMIDAL     = 0x04,
-  IMP_ENC_GOP_CTRL_MODE_SMARTP		  = 0xfe,
+  IMP_ENC_GOP_CTRL_MODE_DEFAULT       = 0x02, /**< Default GOP structure */
+  IMP_ENC_GOP_CTRL_MODE_PYRAMIDAL     = 0x04, /**< Pyramidal GOP structure */
+  IMP_ENC_GOP_CTRL_MODE_SMARTP        = 0xfe, /**< Smart P GOP structure */
   IMP_ENC_GOP_CTRL_MAX_ENUM           = 0xff,
 } IMPEncoderGopCtrlMode;
 
+/**
+ * Define the GOP attribute of the encoder channel
+ */
 typedef struct {
-  IMPEncoderGopCtrlMode   uGopCtrlMode;
-  uint16_t                uGopLength;
+  IMPEncoderGopCtrlMode   uGopCtrlMode;       /**< GOP control mode */
+  uint16_t                uGopLength;         /**< GOP length */
   //uint8_t                 uNumB;
-  uint8_t				  uNotifyUserLTInter;
-  uint32_t                uMaxSameSenceCnt;
-  bool                    bEnableLT;
-  uint32_t                uFreqLT;
-  bool                    bLTRC;
+  uint8_t                 uNotifyUserLTInter;
+  uint32_t                uMaxSameSenceCnt;   /**< GOPLength = uGopLength * uMaxSameSenceCnt, default is 2 */
+  bool                    bEnableLT;          /**< Enable the long-term reference frame */
+  uint32_t                uFreqLT;            /**< Long-term reference frame frequency */
+  bool                    bLTRC;              /**< LTRC enable */
 } IMPEncoderGopAttr;
 
+/**
+ * Define the rate control mode of the encoder channel
+ */
 typedef enum {
-  IMP_ENC_RC_MODE_FIXQP             = 0x0,
-  IMP_ENC_RC_MODE_CBR               = 0x1,
-  IMP_ENC_RC_MODE_VBR               = 0x2,
-  IMP_ENC_RC_MODE_CAPPED_VBR        = 0x4,
-  IMP_ENC_RC_MODE_CAPPED_QUALITY    = 0x8,
-  IMP_ENC_RC_MODE_INVALID           = 0xff,
+  IMP_ENC_RC_MODE_FIXQP             = 0x0,  /**< Fixed QP */
+  IMP_ENC_RC_MODE_CBR               = 0x1,  /**< Constant bitrate */
+  IMP_ENC_RC_MODE_VBR               = 0x2,  /**< Variable bitrate */
+  IMP_ENC_RC_MODE_CAPPED_VBR        = 0x4,  /**< Capped variable bitrate */
+  IMP_ENC_RC_MODE_CAPPED_QUALITY    = 0x8,  /**< Capped quality */
+  IMP_ENC_RC_MODE_INVALID           = 0xff, /**< Invalid mode */
 } IMPEncoderRcMode;
 
+/**
+ * Define the rate control options, used as a bit mask in eRcOptions
+ */
 typedef enum IMPEncoderRcOptions {
-  IMP_ENC_RC_OPT_NONE           = 0x00000000,
-  IMP_ENC_RC_SCN_CHG_RES        = 0x00000001,
-  IMP_ENC_RC_DELAYED            = 0x00000002,
-  IMP_ENC_RC_STATIC_SCENE       = 0x00000004,
-  IMP_ENC_RC_ENABLE_SKIP        = 0x00000008,
-  IMP_ENC_RC_OPT_SC_PREVENTION  = 0x00000010,
+  IMP_ENC_RC_OPT_NONE           = 0x00000000, /**< No option */
+  IMP_ENC_RC_SCN_CHG_RES        = 0x00000001, /**< Scene change option */
+  IMP_ENC_RC_DELAYED            = 0x00000002, /**< Delayed option */
+  IMP_ENC_RC_STATIC_SCENE       = 0x00000004, /**< Static scene option */
+  IMP_ENC_RC_ENABLE_SKIP        = 0x00000008, /**< Enable frame skipping */
+  IMP_ENC_RC_OPT_SC_PREVENTION  = 0x00000010, /**< SC prevention option */
   IMP_ENC_RC_MAX_ENUM,
 } IMPEncoderRcOptions;
 
+/**
+ * Define the FixQP rate control attribute
+ */
 typedef struct {
-  int16_t       iInitialQP;
+  int16_t       iInitialQP; /**< QP of the first frame */
 } IMPEncoderAttrFixQP;
 
+/**
+ * Define the CBR rate control attribute
+ */
 typedef struct {
-  uint32_t              uTargetBitRate;
-  int16_t               iInitialQP;
-  int16_t               iMinQP;
-  int16_t               iMaxQP;
-  int16_t               iIPDelta;
-  int16_t               iPBDelta;
-  uint32_t              eRcOptions;
-  uint32_t              uMaxPictureSize;
+  uint32_t              uTargetBitRate;  /**< Target bitrate */
+  int16_t               iInitialQP;      /**< QP of the first frame */
+  int16_t               iMinQP;          /**< Minimum QP */
+  int16_t               iMaxQP;          /**< Maximum QP */
+  int16_t               iIPDelta;        /**< QP difference between I frame and the first P frame after it */
+  int16_t               iPBDelta;        /**< QP difference between P frame and B frame */
+  uint32_t              eRcOptions;      /**< Rate control options, bitwise OR of IMPEncoderRcOptions */
+  uint32_t              uMaxPictureSize; /**< Maximum size of a coded picture */
 } IMPEncoderAttrCbr;
 
+/**
+ * Define the VBR rate control attribute
+ */
 typedef struct {
-  uint32_t              uTargetBitRate;
-  uint32_t              uMaxBitRate;
-  int16_t               iInitialQP;
-  int16_t               iMinQP;
-  int16_t               iMaxQP;
-  int16_t               iIPDelta;
-  int16_t               iPBDelta;
-  uint32_t              eRcOptions;
-  uint32_t              uMaxPictureSize;
+  uint32_t              uTargetBitRate;  /**< Target bitrate */
+  uint32_t              uMaxBitRate;     /**< Maximum bitrate */
+  int16_t               iInitialQP;      /**< QP of the first frame */
+  int16_t               iMinQP;          /**< Minimum QP */
+  int16_t               iMaxQP;          /**< Maximum QP */
+  int16_t               iIPDelta;        /**< QP difference between I frame and the first P frame after it */
+  int16_t               iPBDelta;        /**< QP difference between P frame and B frame */
+  uint32_t              eRcOptions;      /**< Rate control options, bitwise OR of IMPEncoderRcOptions */
+  uint32_t              uMaxPictureSize; /**< Maximum size of a coded picture */
 } IMPEncoderAttrVbr;
 
+/**
+ * Define the capped VBR rate control attribute, also used for capped quality
+ */
 typedef struct {
-  uint32_t              uTargetBitRate;
-  uint32_t              uMaxBitRate;
-  int16_t               iInitialQP;
-  int16_t               iMinQP;
-  int16_t               iMaxQP;
-  int16_t               iIPDelta;
-  int16_t               iPBDelta;
-  uint32_t              eRcOptions;
-  uint32_t              uMaxPictureSize;
-  uint16_t              uMaxPSNR;
+  uint32_t              uTargetBitRate;  /**< Target bitrate */
+  uint32_t              uMaxBitRate;     /**< Maximum bitrate */
+  int16_t               iInitialQP;      /**< QP of the first frame */
+  int16_t               iMinQP;          /**< Minimum QP */
+  int16_t               iMaxQP;          /**< Maximum QP */
+  int16_t               iIPDelta;        /**< QP difference between I frame and the first P frame after it */
+  int16_t               iPBDelta;        /**< QP difference between P frame and B frame */
+  uint32_t              eRcOptions;      /**< Rate control options, bitwise OR of IMPEncoderRcOptions */
+  uint32_t              uMaxPictureSize; /**< Maximum size of a coded picture */
+  uint16_t              uMaxPSNR;        /**< Maximum PSNR */
 } IMPEncoderAttrCappedVbr;
 
 typedef IMPEncoderAttrCappedVbr IMPEncoderAttrCappedQuality;
 
+/**
+ * Define the rate control attribute of the encoder channel
+ */
 typedef struct {
-  IMPEncoderRcMode              rcMode;
+  IMPEncoderRcMode              rcMode; /**< Rate control mode, selects the member of the union below */
   union {
     IMPEncoderAttrFixQP         attrFixQp;
     IMPEncoderAttrCbr           attrCbr;
@@ -542,6 +569,8 @@ int IMP_Encoder_Query(int encChn, IMPEncoderChnStat *stat);
  * @remarks For H264 and h265 code streams, call success to get a frame code stream, which may contain multiple packets.
  * @remarks For JPEG type code stream, call success to get one frame code stream at a time. This frame code stream only contains one package,
  * and this frame contains the complete information of JPEG image file.
+ * @remarks The packets of a frame stream are stored in a ring buffer which starts at virAddr and is streamSize bytes long, pack.offset is relative to virAddr.
+ * A packet may wrap around the end of this buffer and continue at virAddr, see the example below.
  *
  * example:
  * @code
@@ -561,11 +590,25 @@ int IMP_Encoder_Query(int encChn, IMPEncoderChnStat *stat);
  *
  * int i, nr_pack = stream.packCount;
  * for (i = 0; i < nr_pack; i++) {                            //Save each packet of this frame stream.
- *     ret = write(stream_fd, (void *)stream.pack[i].virAddr,
- *                stream.pack[i].length);
- *     if (ret != stream.pack[i].length) {
- *         printf("stream write error:%s\n", strerror(errno));
- *         return -1;
+ *     IMPEncoderPack *pack = &stream.pack[i];
+ *     uint32_t remSize = stream.streamSize - pack->offset;
+ *     if (remSize < pack->length) {                          //The packet wraps around the end of the stream buffer.
+ *         ret = write(stream_fd, (void *)(stream.virAddr + pack->offset), remSize);
+ *         if (ret != remSize) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
+ *         ret = write(stream_fd, (void *)stream.virAddr, pack->length - remSize);
+ *         if (ret != pack->length - remSize) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
+ *     } else {
+ *         ret = write(stream_fd, (void *)(stream.virAddr + pack->offset), pack->length);
+ *         if (ret != pack->length) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
  *     }
  * }
  * @endcode
@@ -617,7 +660,7 @@ int IMP_Encoder_PollingStream(int encChn, uint32_t timeoutMsec);
 /**
  * @fn int IMP_Encoder_PollingModuleStream(uint32_t *encChnBitmap, uint32_t timeoutMsec)
  *
- * Poling the encoded stream of each channel of the whole encoding module.
+ * Polling the encoded stream of each channel of the whole encoding module.
  *
  * @param[out] encChnBitmap: Each bits represents the corresponding channel number, If there is a coded stream, the corresponding position 1, otherwise set to 0.
  * @param[in] timeoutMsec:   overtimes, unit: ms.
@@ -646,6 +689,38 @@ int IMP_Encoder_PollingModuleStream(uint32_t *encChnBitmap, uint32_t timeoutMsec
  * @remarks If using IMP_Encoder_PollingStream is not suitable, For example, When the coding of multiple coding channels is completed in the same place,
  * you can use this file handle to call select, poll and other similar functions to block waiting for encoding to complete.
  * @remarks If the channel is not created, then return fails.
+ * @remarks The file handle becomes readable (POLLIN) when a stream is available, IMP_Encoder_GetStream can then be called without blocking.
+ *
+ * example:
+ * @code
+ * struct pollfd pfd[2];
+ * int chn[2] = {0, 1};
+ * int i;
+ *
+ * for (i = 0; i < 2; i++) {
+ *     pfd[i].fd = IMP_Encoder_GetFd(chn[i]);
+ *     pfd[i].events = POLLIN;
+ * }
+ *
+ * while (1) {                                                //Wait on several channels at once.
+ *     int ret = poll(pfd, 2, 1000);
+ *     if (ret < 0) {
+ *         if (errno == EINTR)
+ *             continue;
+ *         printf("poll error:%s\n", strerror(errno));
+ *         return -1;
+ *     }
+ *     for (i = 0; i < 2; i++) {
+ *         IMPEncoderStream stream;
+ *         if (!(pfd[i].revents & POLLIN))
+ *             continue;
+ *         if (IMP_Encoder_GetStream(chn[i], &stream, 0) < 0)  //Stream is ready, do not block.
+ *             continue;
+ *         ......                                             //Handle the stream.
+ *         IMP_Encoder_ReleaseStream(chn[i], &stream);
+ *     }
+ * }
+ * @endcode
  *
  * @attention none.
  */
@@ -657,7 +732,7 @@ int IMP_Encoder_GetFd(int encChn);
  * Set JPEG channel to share H265/H264 encoding channel.
  *
  * @param[in] encChn:   Channel ID, range: [0, @ref NR_MAX_ENC_CHN - 1].
- * @param[in] sharechn: Shared H264/H265 channel number, range: [0, @ref NR_MAX_ENC_CHN - 1].
+ * @param[in] shareChn: Shared H264/H265 channel number, range: [0, @ref NR_MAX_ENC_CHN - 1].
  *
  * @retval 0			success.
  * @retval ~0			failed.
@@ -797,7 +872,8 @@ int IMP_Encoder_SetChnFrmRate(int encChn, const IMPEncoderFrmRate *pstFps);
  * Set bitrate attribute dynamically.
  *
  * @param[in] encChn:         Channel ID, range: [0, @ref NR_MAX_ENC_CHN - 1].
- * @param[in] iTargetBitRate: Target bitrate, iMaxBitRate Max bitrate unit: "bit/s".
+ * @param[in] iTargetBitRate: Target bitrate, unit: "bit/s".
+ * @param[in] iMaxBitRate:    Max bitrate, unit: "bit/s".
  *
  * @retval 0			success.
  * @retval ~0			failed.
@@ -809,6 +885,21 @@ int IMP_Encoder_SetChnFrmRate(int encChn, const IMPEncoderFrmRate *pstFps);
  */
 int IMP_Encoder_SetChnBitRate(int encChn, int iTargetBitRate, int iMaxBitRate);
 
+/**
+ * @fn int IMP_Encoder_SetChnGopLength(int encChn, int iGopLength);
+ *
+ * Set the GOP length property of the encoding channel.
+ *
+ * @param[in] encChn:     Channel ID, range: [0, @ref NR_MAX_ENC_CHN - 1].
+ * @param[in] iGopLength: GOP length, in frames.
+ *
+ * @retval 0			success.
+ * @retval ~0			failed.
+ *
+ * @remarks Calling this API requires that the channel already exists.
+ *
+ * @attention This API is only applicable to H264 and H265 encoding channels.
+ */
 int IMP_Encoder_SetChnGopLength(int encChn, int iGopLength);
 
 /**
@@ -939,7 +1030,7 @@ int IMP_Encoder_GetFisheyeEnableStatus(int encChn, int *enable);
 int IMP_Encoder_GetChnEncType(int encChn, IMPEncoderEncType *encType);
 
 /**
- * @brief IMP_Encoder_SetPool(int chnNum, int poolID);
+ * @fn int IMP_Encoder_SetPool(int chnNum, int poolID);
  *
  * bind channel to mempool, let chnNum malloc from pool.
  *
@@ -959,7 +1050,7 @@ int IMP_Encoder_GetChnEncType(int encChn, IMPEncoderEncType *encType);
 int IMP_Encoder_SetPool(int chnNum, int poolID);
 
 /**
- * @brief IMP_Encoder_GetPool(int chnNum);
+ * @fn int IMP_Encoder_GetPool(int chnNum);
  *
  * Get Pool ID by chnannel ID.
  *
@@ -975,12 +1066,12 @@ int IMP_Encoder_SetPool(int chnNum, int poolID);
 int IMP_Encoder_GetPool(int chnNum);
 
 /**
- * @brief IMP_Encoder_SetStreamBufSize(int encChn, uint32_t nrStreamSize);
+ * @fn int IMP_Encoder_SetStreamBufSize(int encChn, uint32_t nrStreamSize);
  *
  * Set size of Stream buffer.
  *
  * @param[in] encChn:       Channel ID.
- * @param[in] nrStreamSize: size of Stream buffer.
+ * @param[in] nrStreamSize: size of Stream buffer, unit: bytes.
  *
  * @retval  >=0 && < 32     success.
  * @retval  <0			    failed.
@@ -992,7 +1083,7 @@ int IMP_Encoder_GetPool(int chnNum);
 int IMP_Encoder_SetStreamBufSize(int encChn, uint32_t nrStreamSize);
 
 /**
- * @brief IMP_Encoder_GetStreamBufSize(int encChn, uint32_t *nrStreamSize);
+ * @fn int IMP_Encoder_GetStreamBufSize(int encChn, uint32_t *nrStreamSize);
  *
  * Get size of Stream buffer.
  *
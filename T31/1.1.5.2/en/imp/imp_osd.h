@@ -34,7 +34,7 @@ extern "C"
  * Region is a superimposed area, in the API Rgn. each Region has a certain image information, after superimposing each OSD module, and the background image into a picture.
  * For the image superimposition, you can also achieve the Alpha effect. For a detailed description of the various types please refer to @ref osd_region_type.
  *
- * @subsection osd_region_type 2.1 Region type
+ * @subsection osd_region_type 2.2 Region type
  * There are several types of Region, respectively as:\n
  * OSD_REG_LINE：line\n
  * OSD_REG_RECT：rectangle\n
@@ -149,8 +149,8 @@ typedef struct {
 	IMPPoint			offPos;			/**< display start coordinates*/
 	float				scalex;			/**< zoom x parameters*/
 	float				scaley;			/**< zoom y parameters*/
-	int				gAlphaEn;		/**< Alpha switch*/
-	int				fgAlhpa;		/**< prospect Alpha*/
+	int				gAlphaEn;		/**< Alpha switch, 0: disable, 1: enable*/
+	int				fgAlhpa;		/**< foreground Alpha*/
 	int				bgAlhpa;		/**< background Alpha*/
 	int				layer;			/**< display layer*/
 } IMPOSDGrpRgnAttr;
@@ -177,7 +177,8 @@ int IMP_System_Exit(void);
  *
  * @retval timestamp(usec).
  *
- * @remarks After the system initialization, the time stamp is initialized automatically.
+ * @remarks After the system initialization, the time stamp is initialized automatically. The time stamp is invalid after the system exits.
+ * @remarks Frame time stamps (IMPFrameInfo::timeStamp) and encoder stream time stamps use the same time base, so they can be compared with this value.
  *
  * @attention None.
  */
@@ -317,7 +318,7 @@ int IMP_System_UnBind(IMPCell *srcCell, IMPCell *dstCell);
 int IMP_System_GetBindbyDest(IMPCell *dstCell, IMPCell *srcCell);
 
 /**
- * @brief IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
+ * @fn int IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
  *
  * Request memory pool on Rmem
  *
@@ -345,7 +346,7 @@ int IMP_System_GetBindbyDest(IMPCell *dstCell, IMPCell *srcCell);
 int IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
 
 /**
- * @brief IMP_System_MemPoolFree
+ * @fn int IMP_System_MemPoolFree(int poolId)
  *
  * @param[in] poolId:  release mempool rmem area memory
  *
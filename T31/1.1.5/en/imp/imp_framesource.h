@@ -513,7 +513,7 @@ int IMP_FrameSource_SetChnFifoAttr(int chnNum, IMPFSChnFifoAttr *attr);
 int IMP_FrameSource_GetChnFifoAttr(int chnNum, IMPFSChnFifoAttr *attr);
 
 /**
- * @brief IMP_FrameSource_SetPool(int chnNum, int poolID);
+ * @fn int IMP_FrameSource_SetPool(int chnNum, int poolID);
  *
  * bind channel to mempool, let chnNum malloc from pool.
  *
@@ -533,7 +533,7 @@ int IMP_FrameSource_GetChnFifoAttr(int chnNum, IMPFSChnFifoAttr *attr);
 int IMP_FrameSource_SetPool(int chnNum, int poolID);
 
 /**
- * @brief IMP_FrameSource_GetPool(int chnNum);
+ * @fn int IMP_FrameSource_GetPool(int chnNum);
  *
  * Get Pool ID by chnannel ID.
  *
@@ -49,7 +49,7 @@ extern "C"
  * Cell is mainly to bind(@bind ). According to the definition of Device, Group, and Output, Output is the output node and Group is the input node.\n
  * When Binding, the output node refers to the output Cell's Output, and the input node refers to the input Cell's Group (so Cell as a data entry, Output is a meaningless value).
  *
- *subsection channel 1.5 Channel
+ * @subsection channel 1.5 Channel
  *
  * Channel usually refers to a single function of the unit. Specific function needs to be appointed while creating a Channel.\n
  * For example, The Channnel of the Encoder is used for H264 encoding or JPEG encoding. The specific algorithm type parameters are appointed when the channel is created.
@@ -196,7 +196,8 @@ int IMP_System_Exit(void);
  *
  * @retval timestamp(usec).
  *
- * @remarks After the system initialization, the time stamp is initialized automatically.
+ * @remarks After the system initialization, the time stamp is initialized automatically. The time stamp is invalid after the system exits.
+ * @remarks Frame time stamps (IMPFrameInfo::timeStamp) and encoder stream time stamps use the same time base, so they can be compared with this value.
  *
  * @attention None.
  */
@@ -336,7 +337,7 @@ int IMP_System_UnBind(IMPCell *srcCell, IMPCell *dstCell);
 int IMP_System_GetBindbyDest(IMPCell *dstCell, IMPCell *srcCell);
 
 /**
- * @brief IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
+ * @fn int IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
  *
  * Request memory pool on Rmem
  *
@@ -364,7 +365,7 @@ int IMP_System_GetBindbyDest(IMPCell *dstCell, IMPCell *srcCell);
 int IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
 
 /**
- * @brief IMP_System_MemPoolFree
+ * @fn int IMP_System_MemPoolFree(int poolId)
  *
  * @param[in] poolId:  release mempool rmem area memory
  *
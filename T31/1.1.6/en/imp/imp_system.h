@@ -49,21 +49,20 @@ extern "C"
  * Cell is mainly to bind(@bind ). According to the definition of Device, Group, and Output, Output is the output node and Group is the input node.\n
  * When Binding, the output node refers to the output Cell's Output, and the input node refers to the input Cell's Group (so Cell as a data entry, Output is a meaningless value).
  *
- *subsection channel 1.5 Channel
- *
+ * @subsection channel 1.5 Channel
  * Channel usually refers to a single function of the unit. Specific function needs to be appointed while creating a Channel.\n
  * For example, The Channnel of the Encoder is used for H264 encoding or JPEG encoding. The specific algorithm type parameters are appointed when the channel is created.
  * For OSD, there is a similar concept with Channel, Region. A Region is a specific overlay area, it can be PIC (image), COVER (block), etc.\n
  *
  *For FrameSource, one Channel outputs one single original image, Channel FrameSource is actually Group
-*
-* Channel as a functional unit, usually requires Register to Group (except FrameSource), in order to receive data. The Channel once registered to Group, it will get the Group input.
+ *
+ * Channel as a functional unit, usually requires Register to Group (except FrameSource), in order to receive data. The Channel once registered to Group, it will get the Group input.
  * For different Group Device, the Register Channel number is also different.
  *
  * @section bind 2 Bind
  * After binding two Groups, the source Group data will be automaticly sent to the destination Group.
- * Because the group is the smallest unit of data input and Output is the smallest unit of data output, therefore the srcCell's two parameters(deviceID, groupid) of IMP system bind (IMPCell *srcCell,     IMPCell *dstCell) . OutputID is effective
- * while dstCell only deviceID and groupID are valid, outputID is meaningless as a data entry. \n
+ * Because the group is the smallest unit of data input and Output is the smallest unit of data output, all three parameters (deviceID, groupID, outputID) of srcCell in IMP_System_Bind(IMPCell *srcCell, IMPCell *dstCell) are effective,
+ * while for dstCell only deviceID and groupID are valid, outputID is meaningless as a data entry. \n
  * the following figure is a simple example of Bind.
  *
  * @image HTML system_bind0.jpg
@@ -111,7 +110,7 @@ extern "C"
  * if (ret < 0)
  *     printf("Bind FrameSource Channel0 and OSD Group0 failed\n");
  *
- * int ret = IMP_System_Bind(&osd_grp0, &enc_grp0);
+ * ret = IMP_System_Bind(&osd_grp0, &enc_grp0);
  * if (ret < 0)
  *     printf("Bind OSD Group0 and Encoder Group0 failed\n");
  * @endcode
@@ -127,11 +126,11 @@ extern "C"
  * if (ret < 0)
  *     printf("Bind FrameSource Channel1 and OSD Group1 failed\n");
  *
- * int ret = IMP_System_Bind(&osd_grp1, &enc_grp1);
+ * ret = IMP_System_Bind(&osd_grp1, &enc_grp1);
  * if (ret < 0)
  *     printf("Bind OSD Group1 and Encoder Group1 failed\n");
  *
- * int ret = IMP_System_Bind(&fs_chn1_output1, &ivs_grp0);
+ * ret = IMP_System_Bind(&fs_chn1_output1, &ivs_grp0);
  * if (ret < 0)
  *     printf("Bind FrameSource Channel1 Output1 and IVS failed\n");
  * @endcode
@@ -196,7 +195,8 @@ int IMP_System_Exit(void);
  *
  * @retval timestamp(usec).
  *
- * @remarks After the system initialization, the time stamp is initialized automatically.
+ * @remarks After the system initialization, the time stamp is initialized automatically. The time stamp is invalid after the system exits.
+ * @remarks Frame time stamps (IMPFrameInfo::timeStamp) and encoder stream time stamps use the same time base, so they can be compared with this value.
  *
  * @attention None.
  */
@@ -219,7 +219,7 @@ int64_t IMP_System_GetTimeStamp(void);
 int IMP_System_RebaseTimeStamp(int64_t basets);
 
 /**
- * @fn uint32_t IMP_System_ReadReg32(uint32_t u32Addr)
+ * @fn uint32_t IMP_System_ReadReg32(uint32_t regAddr)
  *
  * Read the register(32bit) value.
  *
@@ -322,8 +322,8 @@ int IMP_System_UnBind(IMPCell *srcCell, IMPCell *dstCell);
  *
  * Gets the source Cell information that is bound to the destination Cell.
  *
- * @param[out] srcCell The source Cell pointer.
  * @param[in] dstCell The destination Cell pointer.
+ * @param[out] srcCell The source Cell pointer.
  *
  *
  * @retval 0 Success.
@@ -336,7 +336,7 @@ int IMP_System_UnBind(IMPCell *srcCell, IMPCell *dstCell);
 int IMP_System_GetBindbyDest(IMPCell *dstCell, IMPCell *srcCell);
 
 /**
- * @brief IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
+ * @fn int IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
  *
  * Request memory pool on Rmem
  *
@@ -364,7 +364,7 @@ int IMP_System_GetBindbyDest(IMPCell *dstCell, IMPCell *srcCell);
 int IMP_System_MemPoolRequest(int poolId, size_t size, const char *name);
 
 /**
- * @brief IMP_System_MemPoolFree
+ * @fn int IMP_System_MemPoolFree(int poolId)
  *
  * @param[in] poolId:  release mempool rmem area memory
  *
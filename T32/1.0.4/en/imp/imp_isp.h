@@ -2471,7 +2471,7 @@ typedef struct {
  * }
  * @endcode
  *
- * @attention Before using that function, make sure that ISP is working properly.
+ * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_SetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
 
@@ -2498,7 +2498,7 @@ int32_t IMP_ISP_Tuning_SetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
  * printf("af weight:...\n", ...);
  * @endcode
  *
- * @attention Before using that function, make sure that ISP is working properly.
+ * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_GetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
 
@@ -2629,7 +2629,7 @@ typedef struct {
 /**
 * @fn int32_t IMP_ISP_Tuning_GetAeStatistics(IMPVI_NUM num, IMPISPAEStatisInfo *ae_statis)
 *
-* set ae weight
+* get ae statistics
 *
 * @param[in]   num				   The sensor num label.
 * @param[out]  ae_statis		   ae statistics.
@@ -2641,14 +2641,14 @@ typedef struct {
  * int ret = 0;
  * IMPISPAEStatisInfo info;
  *
- * ret = IMP_ISP_Tuning_GetAeStatistics(IMPVI_MAIN, &statis);
+ * ret = IMP_ISP_Tuning_GetAeStatistics(IMPVI_MAIN, &info);
  * if(ret){
  *	IMP_LOG_ERR(TAG, "IMP_ISP_Tuning_GetAeStatistics error !\n");
  *	return -1;
  * }
  *
  * printf("ae hist 5bin:...\n", info.ae_hist_5bin[...]);
- * printf("ae hist 256bin:...\n, info.ae_hist_256bin[...]");
+ * printf("ae hist 256bin:...\n", info.ae_hist_256bin[...]);
  * printf("ae statis:...\n", info.ae_statis.statis[...][...]);
  * @endcode
  *
@@ -2660,17 +2660,17 @@ int32_t IMP_ISP_Tuning_GetAeStatistics(IMPVI_NUM num, IMPISPAEStatisInfo *ae_sta
  * AF statistics info each area
  */
 typedef struct {
-	IMPISPStatisZone Af_Fir0;
-	IMPISPStatisZone Af_Fir1;
-	IMPISPStatisZone Af_Iir0;
-	IMPISPStatisZone Af_Iir1;
-	IMPISPStatisZone Af_YSum;
-	IMPISPStatisZone Af_HighLumaCnt;
+	IMPISPStatisZone Af_Fir0;           /**< AF statistics of FIR filter 0 for each zone */
+	IMPISPStatisZone Af_Fir1;           /**< AF statistics of FIR filter 1 for each zone */
+	IMPISPStatisZone Af_Iir0;           /**< AF statistics of IIR filter 0 for each zone */
+	IMPISPStatisZone Af_Iir1;           /**< AF statistics of IIR filter 1 for each zone */
+	IMPISPStatisZone Af_YSum;           /**< Luma sum of each zone */
+	IMPISPStatisZone Af_HighLumaCnt;    /**< Number of the highlight pixels for each zone */
 } IMPISPAFStatisInfo;
 /**
  * @fn int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis)
  *
- * get awb weight
+ * get af statistics
  *
  * @param[in]	 num					 The sensor num label.
  * @param[out]	 af_statis				 af statistics.
@@ -2690,6 +2690,8 @@ typedef struct {
  * printf("af statis:...\n", ...);
  * @endcode
  *
+ * @remarks Each member holds the statistics of 15*15 zones, laid out like the weight table of IMP_ISP_Tuning_SetAfWeight.
+ *
  * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis);
@@ -3893,13 +3895,17 @@ int IMP_ISP_Tuning_DestroyOsdRgn(int chn,int handle);
 /**
  * @fn int32_t IMP_ISP_SetVicDoneCbFunc(void (*cb)(void))
  *
- * When a frame of data is accepted, the callback function will be executed.
+ * The callback function is executed each time the ISP VIC finishes receiving a frame.
  *
  * @param[in] cb	The pointer for callback function.
  *
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
+ * @remarks The callback is called once for each frame and should return quickly.
+ * @remarks To get the statistics of the frame, wake up another thread in the callback and call IMP_ISP_Tuning_GetAeStatistics,
+ * IMP_ISP_Tuning_GetAwbStatistics and IMP_ISP_Tuning_GetAfStatistics from there.
+ *
  * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_SetVicDoneCbFunc(void (*cb)(void));
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "imp_common.h"
 
 #ifdef __cplusplus
 #if __cplusplus
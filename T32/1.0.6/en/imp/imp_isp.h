@@ -2632,14 +2632,14 @@ typedef struct {
  * int ret = 0;
  * IMPISPAEStatisInfo info;
  *
- * ret = IMP_ISP_Tuning_GetAeStatistics(IMPVI_MAIN, &statis);
+ * ret = IMP_ISP_Tuning_GetAeStatistics(IMPVI_MAIN, &info);
  * if(ret){
  *	IMP_LOG_ERR(TAG, "IMP_ISP_Tuning_GetAeStatistics error !\n");
  *	return -1;
  * }
  *
  * printf("ae hist 5bin:...\n", info.ae_hist_5bin[...]);
- * printf("ae hist 256bin:...\n, info.ae_hist_256bin[...]");
+ * printf("ae hist 256bin:...\n", info.ae_hist_256bin[...]);
  * printf("ae statis:...\n", info.ae_statis.statis[...][...]);
  * @endcode
  *
@@ -2651,12 +2651,12 @@ int32_t IMP_ISP_Tuning_GetAeStatistics(IMPVI_NUM num, IMPISPAEStatisInfo *ae_sta
  * AF statistics info each area
  */
 typedef struct {
-	IMPISPStatisZone Af_Fir0;
-	IMPISPStatisZone Af_Fir1;
-	IMPISPStatisZone Af_Iir0;
-	IMPISPStatisZone Af_Iir1;
-	IMPISPStatisZone Af_YSum;
-	IMPISPStatisZone Af_HighLumaCnt;
+	IMPISPStatisZone Af_Fir0;           /**< AF statistics of FIR filter 0 for each zone */
+	IMPISPStatisZone Af_Fir1;           /**< AF statistics of FIR filter 1 for each zone */
+	IMPISPStatisZone Af_Iir0;           /**< AF statistics of IIR filter 0 for each zone */
+	IMPISPStatisZone Af_Iir1;           /**< AF statistics of IIR filter 1 for each zone */
+	IMPISPStatisZone Af_YSum;           /**< Luma sum of each zone */
+	IMPISPStatisZone Af_HighLumaCnt;    /**< Number of the highlight pixels for each zone */
 } IMPISPAFStatisInfo;
 /**
  * @fn int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis)
@@ -2681,6 +2681,8 @@ typedef struct {
  * printf("af statis:...\n", ...);
  * @endcode
  *
+ * @remarks Each member holds the statistics of 15*15 zones, laid out like the weight table of IMP_ISP_Tuning_SetAfWeight.
+ *
  * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis);
@@ -1784,15 +1784,15 @@ int32_t IMP_ISP_Tuning_GetAwbWeight(IMPVI_NUM num, IMPISPWeight *awb_weight);
  * AF statistics info each area
  */
 typedef struct {
-	IMPISPStatisZone Af_Fir0;
-	IMPISPStatisZone Af_Fir1;
-	IMPISPStatisZone Af_Iir0;
-	IMPISPStatisZone Af_Iir1;
-	IMPISPStatisZone Af_YSum;           /*高亮点的亮度*/
-	IMPISPStatisZone Af_HighLumaCnt;    /*高亮点的个数*/
+	IMPISPStatisZone Af_Fir0;           /**< 各区域FIR0滤波器的AF统计值 */
+	IMPISPStatisZone Af_Fir1;           /**< 各区域FIR1滤波器的AF统计值 */
+	IMPISPStatisZone Af_Iir0;           /**< 各区域IIR0滤波器的AF统计值 */
+	IMPISPStatisZone Af_Iir1;           /**< 各区域IIR1滤波器的AF统计值 */
+	IMPISPStatisZone Af_YSum;           /**< 各区域亮度和 */
+	IMPISPStatisZone Af_HighLumaCnt;    /**< 各区域高亮点的个数 */
 } IMPISPAFStatisInfo;
 /**
- * @fn IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis)
+ * @fn int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis)
  *
  * 获取AF统计值。
  *
@@ -1802,6 +1802,8 @@ typedef struct {
  * @retval 0 成功
  * @retval 非0 失败，返回错误码
  *
+ * @remarks 每个成员包含15*15个区域的统计值，区域划分与IMP_ISP_Tuning_SetAfWeight的权重表一致。
+ *
  * @attention 在使用这个函数之前，IMP_ISP_EnableTuning已被调用。
  */
 int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis);
@@ -2382,7 +2384,7 @@ typedef struct {
 	uint32_t cur_r_gain;								/**< 白平衡R通道增益 */
 	uint32_t cur_b_gain;								/**< 白平衡B通道增益 */
 	uint32_t r_gain_statis;								/**< 白平衡全局统计值r_gain */
-	uint32_t b_gain_statis;								/**< 白平衡全局加权统计值b_gain */
+	uint32_t b_gain_statis;								/**< 白平衡全局统计值b_gain */
 	uint32_t r_gain_wei_statis;							/**< 白平衡全局加权统计值r_gain */
 	uint32_t b_gain_wei_statis;							/**< 白平衡全局加权统计值b_gain */
 	IMPISPAWBStatisInfo awb_statis;						/**< 白平衡区域统计值 */
@@ -64,7 +64,7 @@ typedef struct {
 	uint32_t virAddr;		/**< frame's virtual address */
 
 	void* pool;
-	int64_t timeStamp;		/**<  frame time stamp*/
+	int64_t timeStamp;		/**< frame time stamp, unit us, same time base as IMP_System_GetTimeStamp */
 	uint32_t priv[0];		/* private data */
 } IMPFrameInfo;
 
@@ -58,14 +58,14 @@ extern "C"
  */
 typedef enum {
 	IMP_H264_NAL_UNKNOWN		= 0,	/**< Undefined */
-	IMP_H264_NAL_SLICE		    = 1,	/**< A encoding strip for non IDR image */
-	IMP_H264_NAL_SLICE_DPA	    = 2,	/**< Encoding stripe data partition block A */
-	IMP_H264_NAL_SLICE_DPB	    = 3,	/**< Encoding stripe data partition block B */
-	IMP_H264_NAL_SLICE_DPC	    = 4,	/**< Encoding stripe data partition block C */
-	IMP_H264_NAL_SLICE_IDR	    = 5,	/**< Encoding strip of IDR image */
+	IMP_H264_NAL_SLICE		    = 1,	/**< Coded slice of a non-IDR picture */
+	IMP_H264_NAL_SLICE_DPA	    = 2,	/**< Coded slice data partition A */
+	IMP_H264_NAL_SLICE_DPB	    = 3,	/**< Coded slice data partition B */
+	IMP_H264_NAL_SLICE_DPC	    = 4,	/**< Coded slice data partition C */
+	IMP_H264_NAL_SLICE_IDR	    = 5,	/**< Coded slice of an IDR picture */
 	IMP_H264_NAL_SEI			= 6,	/**< SEI(Supplemental Enhancement Information) */
-	IMP_H264_NAL_SPS			= 7,	/**< SPS(Sequence Paramater Set) */
-	IMP_H264_NAL_PPS			= 8,	/**< PPS(Picture Paramater Set) */
+	IMP_H264_NAL_SPS			= 7,	/**< SPS(Sequence Parameter Set) */
+	IMP_H264_NAL_PPS			= 8,	/**< PPS(Picture Parameter Set) */
 	IMP_H264_NAL_AUD			= 9,	/**< Access unit separator */
 	IMP_H264_NAL_FILLER		    = 12,	/**< Fill in data */
 } IMPEncoderH264NaluType;
@@ -91,8 +91,8 @@ typedef enum {
     IMP_H265_NAL_SLICE_IDR_N_LP     = 20,       /**< Instant decoding refresh without front image */
     IMP_H265_NAL_SLICE_CRA          = 21,       /**< Pure random access with front image	*/
     IMP_H265_NAL_VPS                = 32,       /**< Video Parameter Set */
-    IMP_H265_NAL_SPS                = 33,       /**< SPS(Sequence Paramater Set) */
-    IMP_H265_NAL_PPS                = 34,       /**< PPS(Picture Paramater Set) */
+    IMP_H265_NAL_SPS                = 33,       /**< SPS(Sequence Parameter Set) */
+    IMP_H265_NAL_PPS                = 34,       /**< PPS(Picture Parameter Set) */
     IMP_H265_NAL_AUD                = 35,       /**< Access unit separator */
     IMP_H265_NAL_EOS                = 36,       /**< End of sequence */
     IMP_H265_NAL_EOB                = 37,       /**< End of bitstream */
@@ -131,8 +131,8 @@ typedef struct {
 	uint32_t	length;						/**< Stream packet length */
 	int64_t	timestamp;						/**< Time stamp, unit us */
 	bool	frameEnd;						/**< End of frame flag */
-	IMPEncoderNalType   nalType;			/**< Nal type of encoder channel */
-	IMPEncoderSliceType sliceType;          /**< Nal type of encoder slice */
+	IMPEncoderNalType   nalType;			/**< NAL unit type of the packet, use h264NalType or h265NalType according to the channel's protocol */
+	IMPEncoderSliceType sliceType;          /**< Slice type of the packet, only meaningful for coded slice NAL units */
 } IMPEncoderPack;
 
 /**
@@ -145,7 +145,7 @@ typedef struct {
 	IMPEncoderPack  *pack;				/**< Frame stream packet */
 	uint32_t        packCount;			/**< The number of all packets in a frame stream */
 	uint32_t        seq;				/**< Sequence number of coded frame */
-	bool 			isVI;
+	bool 			isVI;				/**< Virtual I frame flag */
 } IMPEncoderStream;
 
 typedef enum {
@@ -279,69 +279,90 @@ typedef struct {
   bool                    bLTRC;
 } IMPEncoderGopAttr;
 
+/**
+ * Define the rate control mode of the encoder channel
+ */
 typedef enum {
-  IMP_ENC_RC_MODE_FIXQP             = 0x0,
-  IMP_ENC_RC_MODE_CBR               = 0x1,
-  IMP_ENC_RC_MODE_VBR               = 0x2,
-  IMP_ENC_RC_MODE_CAPPED_VBR        = 0x4,
-  IMP_ENC_RC_MODE_CAPPED_QUALITY    = 0x8,
-  IMP_ENC_RC_MODE_INVALID           = 0xff,
+  IMP_ENC_RC_MODE_FIXQP             = 0x0,  /**< Fixed QP */
+  IMP_ENC_RC_MODE_CBR               = 0x1,  /**< Constant bitrate */
+  IMP_ENC_RC_MODE_VBR               = 0x2,  /**< Variable bitrate */
+  IMP_ENC_RC_MODE_CAPPED_VBR        = 0x4,  /**< Capped variable bitrate */
+  IMP_ENC_RC_MODE_CAPPED_QUALITY    = 0x8,  /**< Capped quality */
+  IMP_ENC_RC_MODE_INVALID           = 0xff, /**< Invalid mode */
 } IMPEncoderRcMode;
 
+/**
+ * Define the rate control options, used as a bit mask in eRcOptions
+ */
 typedef enum IMPEncoderRcOptions {
-  IMP_ENC_RC_OPT_NONE           = 0x00000000,
-  IMP_ENC_RC_SCN_CHG_RES        = 0x00000001,
-  IMP_ENC_RC_DELAYED            = 0x00000002,
-  IMP_ENC_RC_STATIC_SCENE       = 0x00000004,
-  IMP_ENC_RC_ENABLE_SKIP        = 0x00000008,
-  IMP_ENC_RC_OPT_SC_PREVENTION  = 0x00000010,
+  IMP_ENC_RC_OPT_NONE           = 0x00000000, /**< No option */
+  IMP_ENC_RC_SCN_CHG_RES        = 0x00000001, /**< Scene change option */
+  IMP_ENC_RC_DELAYED            = 0x00000002, /**< Delayed option */
+  IMP_ENC_RC_STATIC_SCENE       = 0x00000004, /**< Static scene option */
+  IMP_ENC_RC_ENABLE_SKIP        = 0x00000008, /**< Enable frame skipping */
+  IMP_ENC_RC_OPT_SC_PREVENTION  = 0x00000010, /**< SC prevention option */
   IMP_ENC_RC_MAX_ENUM,
 } IMPEncoderRcOptions;
 
+/**
+ * Define the FixQP rate control attribute
+ */
 typedef struct {
-  int16_t       iInitialQP;
+  int16_t       iInitialQP; /**< QP of the first frame */
 } IMPEncoderAttrFixQP;
 
+/**
+ * Define the CBR rate control attribute
+ */
 typedef struct {
-  uint32_t              uTargetBitRate;
-  int16_t               iInitialQP;
-  int16_t               iMinQP;
-  int16_t               iMaxQP;
-  int16_t               iIPDelta;
-  int16_t               iPBDelta;
-  uint32_t              eRcOptions;
-  uint32_t              uMaxPictureSize;
+  uint32_t              uTargetBitRate;  /**< Target bitrate */
+  int16_t               iInitialQP;      /**< QP of the first frame */
+  int16_t               iMinQP;          /**< Minimum QP */
+  int16_t               iMaxQP;          /**< Maximum QP */
+  int16_t               iIPDelta;        /**< QP difference between I frame and the first P frame after it */
+  int16_t               iPBDelta;        /**< QP difference between P frame and B frame */
+  uint32_t              eRcOptions;      /**< Rate control options, bitwise OR of IMPEncoderRcOptions */
+  uint32_t              uMaxPictureSize; /**< Maximum size of a coded picture */
 } IMPEncoderAttrCbr;
 
+/**
+ * Define the VBR rate control attribute
+ */
 typedef struct {
-  uint32_t              uTargetBitRate;
-  uint32_t              uMaxBitRate;
-  int16_t               iInitialQP;
-  int16_t               iMinQP;
-  int16_t               iMaxQP;
-  int16_t               iIPDelta;
-  int16_t               iPBDelta;
-  uint32_t              eRcOptions;
-  uint32_t              uMaxPictureSize;
+  uint32_t              uTargetBitRate;  /**< Target bitrate */
+  uint32_t              uMaxBitRate;     /**< Maximum bitrate */
+  int16_t               iInitialQP;      /**< QP of the first frame */
+  int16_t               iMinQP;          /**< Minimum QP */
+  int16_t               iMaxQP;          /**< Maximum QP */
+  int16_t               iIPDelta;        /**< QP difference between I frame and the first P frame after it */
+  int16_t               iPBDelta;        /**< QP difference between P frame and B frame */
+  uint32_t              eRcOptions;      /**< Rate control options, bitwise OR of IMPEncoderRcOptions */
+  uint32_t              uMaxPictureSize; /**< Maximum size of a coded picture */
 } IMPEncoderAttrVbr;
 
+/**
+ * Define the capped VBR rate control attribute, also used for capped quality
+ */
 typedef struct {
-  uint32_t              uTargetBitRate;
-  uint32_t              uMaxBitRate;
-  int16_t               iInitialQP;
-  int16_t               iMinQP;
-  int16_t               iMaxQP;
-  int16_t               iIPDelta;
-  int16_t               iPBDelta;
-  uint32_t              eRcOptions;
-  uint32_t              uMaxPictureSize;
-  uint16_t              uMaxPSNR;
+  uint32_t              uTargetBitRate;  /**< Target bitrate */
+  uint32_t              uMaxBitRate;     /**< Maximum bitrate */
+  int16_t               iInitialQP;      /**< QP of the first frame */
+  int16_t               iMinQP;          /**< Minimum QP */
+  int16_t               iMaxQP;          /**< Maximum QP */
+  int16_t               iIPDelta;        /**< QP difference between I frame and the first P frame after it */
+  int16_t               iPBDelta;        /**< QP difference between P frame and B frame */
+  uint32_t              eRcOptions;      /**< Rate control options, bitwise OR of IMPEncoderRcOptions */
+  uint32_t              uMaxPictureSize; /**< Maximum size of a coded picture */
+  uint16_t              uMaxPSNR;        /**< Maximum PSNR */
 } IMPEncoderAttrCappedVbr;
 
 typedef IMPEncoderAttrCappedVbr IMPEncoderAttrCappedQuality;
 
+/**
+ * Define the rate control attribute of the encoder channel
+ */
 typedef struct {
-  IMPEncoderRcMode              rcMode;
+  IMPEncoderRcMode              rcMode; /**< Rate control mode, selects the member of the union below */
   union {
     IMPEncoderAttrFixQP         attrFixQp;
     IMPEncoderAttrCbr           attrCbr;
@@ -620,6 +641,8 @@ int IMP_Encoder_Query(int encChn, IMPEncoderChnStat *stat);
  * @remarks For H264 and h265 code streams, call success to get a frame code stream, which may contain multiple packets.
  * @remarks For JPEG type code stream, call success to get one frame code stream at a time. This frame code stream only contains one package,
  * and this frame contains the complete information of JPEG image file.
+ * @remarks The packets of a frame stream are stored in a ring buffer which starts at virAddr and is streamSize bytes long, pack.offset is relative to virAddr.
+ * A packet may wrap around the end of this buffer and continue at virAddr, see the example below.
  *
  * example:
  * @code
@@ -639,11 +662,25 @@ int IMP_Encoder_Query(int encChn, IMPEncoderChnStat *stat);
  *
  * int i, nr_pack = stream.packCount;
  * for (i = 0; i < nr_pack; i++) {                            //Save each packet of this frame stream.
- *     ret = write(stream_fd, (void *)stream.pack[i].virAddr,
- *                stream.pack[i].length);
- *     if (ret != stream.pack[i].length) {
- *         printf("stream write error:%s\n", strerror(errno));
- *         return -1;
+ *     IMPEncoderPack *pack = &stream.pack[i];
+ *     uint32_t remSize = stream.streamSize - pack->offset;
+ *     if (remSize < pack->length) {                          //The packet wraps around the end of the stream buffer.
+ *         ret = write(stream_fd, (void *)(stream.virAddr + pack->offset), remSize);
+ *         if (ret != remSize) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
+ *         ret = write(stream_fd, (void *)stream.virAddr, pack->length - remSize);
+ *         if (ret != pack->length - remSize) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
+ *     } else {
+ *         ret = write(stream_fd, (void *)(stream.virAddr + pack->offset), pack->length);
+ *         if (ret != pack->length) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
  *     }
  * }
  * @endcode
@@ -1468,7 +1468,7 @@ typedef struct {
 /**
 * @fn int32_t IMP_ISP_Tuning_GetAeStatistics(IMPVI_NUM num, IMPISPAEStatisInfo *ae_statis)
 *
-* set ae weight
+* get ae statistics
 *
 * @param[in]   num                 The sensor num label.
 * @param[out]  ae_statis           ae statistics.
@@ -1804,17 +1804,17 @@ int32_t IMP_ISP_Tuning_GetAwbWeight(IMPVI_NUM num, IMPISPWeight *awb_weight);
  * AF statistics info each area
  */
 typedef struct {
-	IMPISPStatisZone Af_Fir0;
-	IMPISPStatisZone Af_Fir1;
-	IMPISPStatisZone Af_Iir0;
-	IMPISPStatisZone Af_Iir1;
-	IMPISPStatisZone Af_YSum;				/* The brightness of the high point */
-	IMPISPStatisZone Af_HighLumaCnt;		/* Number of high highlights */
+	IMPISPStatisZone Af_Fir0;           /**< AF statistics of FIR filter 0 for each zone */
+	IMPISPStatisZone Af_Fir1;           /**< AF statistics of FIR filter 1 for each zone */
+	IMPISPStatisZone Af_Iir0;           /**< AF statistics of IIR filter 0 for each zone */
+	IMPISPStatisZone Af_Iir1;           /**< AF statistics of IIR filter 1 for each zone */
+	IMPISPStatisZone Af_YSum;           /**< Luma sum of each zone */
+	IMPISPStatisZone Af_HighLumaCnt;    /**< Number of the highlight pixels for each zone */
 } IMPISPAFStatisInfo;
 /**
  * @fn int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis)
  *
- * get awb weight
+ * get af statistics
  *
  * @param[in]    num                     The sensor num label.
  * @param[out]   af_statis               af statistics.
@@ -1822,6 +1822,8 @@ typedef struct {
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
+ * @remarks Each member holds the statistics of 15*15 zones, laid out like the weight table of IMP_ISP_Tuning_SetAfWeight.
+ *
  * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis);
@@ -1863,7 +1865,7 @@ int32_t IMP_ISP_Tuning_GetAFMetricesInfo(IMPVI_NUM num, IMPISPAFMetricsInfo *met
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
- * @attention Before using that function, make sure that ISP is working properly.
+ * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_SetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
 /**
@@ -1877,7 +1879,7 @@ int32_t IMP_ISP_Tuning_SetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
- * @attention Before using that function, make sure that ISP is working properly.
+ * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_GetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
 
@@ -2391,30 +2393,30 @@ int32_t IMP_ISP_SetAeAlgoFunc(IMPVI_NUM num, IMPISPAeAlgoFunc *ae_func);
  * 3th custom AWB library AWB init information
  */
 typedef struct {
-	IMPISPAWBStatisAttr AwbStatis; /* awb statis attribution*/
+	IMPISPAWBStatisAttr AwbStatis; /**< awb statis attribution */
 } IMPISPAwbInitAttr;
 
 /**
  * 3th custom AWB library AWB information
  */
 typedef struct {
-	uint32_t cur_r_gain;                   /* current awb r-gain*/
-	uint32_t cur_b_gain;                   /* current awb b-gain*/
-	uint32_t r_gain_statis;                /* current awb r-gain of global statis info*/
-	uint32_t b_gain_statis;                /* current awb b-gain of global statis info*/
-	uint32_t r_gain_wei_statis;            /* current awb r-gain of global weighted statis info*/
-	uint32_t b_gain_wei_statis;            /* current awb b-gain of global weighted statis info*/
-	IMPISPAWBStatisInfo awb_statis;        /* current awb statis info for each zone*/
+	uint32_t cur_r_gain;                   /**< current awb r-gain */
+	uint32_t cur_b_gain;                   /**< current awb b-gain */
+	uint32_t r_gain_statis;                /**< current awb r-gain of global statis info */
+	uint32_t b_gain_statis;                /**< current awb b-gain of global statis info */
+	uint32_t r_gain_wei_statis;            /**< current awb r-gain of global weighted statis info */
+	uint32_t b_gain_wei_statis;            /**< current awb b-gain of global weighted statis info */
+	IMPISPAWBStatisInfo awb_statis;        /**< current awb statis info for each zone, 15 x 15 zones */
 }__attribute__((packed, aligned(1))) IMPISPAwbInfo;
 
 /**
  * 3th custom AWB library AWB attribution
  */
 typedef struct {
-	uint32_t change;  /* change awb attribution or not*/
-	uint32_t r_gain;  /* awb attribution of r-gain*/
-	uint32_t b_gain;  /* awb attribution of b-gain*/
-	uint32_t ct;      /* awb color temp*/
+	uint32_t change;  /**< change awb attribution or not */
+	uint32_t r_gain;  /**< awb attribution of r-gain */
+	uint32_t b_gain;  /**< awb attribution of b-gain */
+	uint32_t ct;      /**< awb color temp */
 } IMPISPAwbAttr;
 
 /**
@@ -2428,11 +2430,11 @@ typedef enum {
  * 3th custom AWB library callback functions
  */
 typedef struct {
-	void *priv_data;                                                                                 /* private data addr*/
-	int (*open)(void *priv_data, IMPISPAwbInitAttr *AwbInitAttr);					 /* AWB open function for 3th custom library*/
-	void (*close)(void *priv_data);									 /* AWB close function for 3th custom library*/
-	void (*handle)(void *priv_data, const IMPISPAwbInfo *AwbInfo, IMPISPAwbAttr *AwbAttr);		 /* AWB handle function for 3th custom library*/
-	int (*notify)(void *priv_data, IMPISPAwbNotify notify, void *data);				 /* AWB notify function for 3th custom library*/
+	void *priv_data;                                                                                 /**< private data addr */
+	int (*open)(void *priv_data, IMPISPAwbInitAttr *AwbInitAttr);					 /**< AWB open function for 3th custom library */
+	void (*close)(void *priv_data);									 /**< AWB close function for 3th custom library */
+	void (*handle)(void *priv_data, const IMPISPAwbInfo *AwbInfo, IMPISPAwbAttr *AwbAttr);		 /**< AWB handle function for 3th custom library */
+	int (*notify)(void *priv_data, IMPISPAwbNotify notify, void *data);				 /**< AWB notify function for 3th custom library */
 } IMPISPAwbAlgoFunc;
 
 /**
@@ -2446,7 +2448,7 @@ typedef struct {
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
- * @attention Before using that function, make sure that IMP_ISP_AddSensor have be called.
+ * @attention This function must be called immediately after IMP_ISP_AddSensor.
  */
 int32_t IMP_ISP_SetAwbAlgoFunc(IMPVI_NUM num, IMPISPAwbAlgoFunc *awb_func);
 
@@ -192,7 +192,8 @@ int IMP_System_Exit(void);
  *
  * @retval timestamp(usec).
  *
- * @remarks After the system initialization, the time stamp is initialized automatically.
+ * @remarks After the system initialization, the time stamp is initialized automatically. The time stamp is invalid after the system exits.
+ * @remarks Frame time stamps (IMPFrameInfo::timeStamp) and encoder stream time stamps use the same time base, so they can be compared with this value.
  *
  * @attention None.
  */
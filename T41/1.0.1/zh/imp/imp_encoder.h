@@ -125,7 +125,7 @@ typedef struct {
 	int64_t                 timestamp;          /**< 时间戳，单位us */
 	bool	                frameEnd;           /**< 帧结束标识 */
 	IMPEncoderNalType       nalType;            /**< H.264和H.265编码Channel码流NAL类型 */
-	IMPEncoderSliceType     sliceType;
+	IMPEncoderSliceType     sliceType;          /**< 码流包的slice类型，仅对slice类型的NAL有效 */
 } IMPEncoderPack;
 
 /**
@@ -627,6 +627,8 @@ int IMP_Encoder_Query(int encChn, IMPEncoderChnStat *stat);
  * 及时而导致的码流 buffer 满,停止编码。
  * @remarks 对于H264和H265类型码流，一次调用成功获取一帧的码流，这帧码流可能包含多个包。
  * @remarks 对于JPEG类型码流，一次调用成功获取一帧的码流，这帧码流只包含一个包，这一帧包含了JPEG图片文件的完整信息。
+ * @remarks 一帧码流的各个包位于以virAddr为起始、大小为streamSize的环形缓冲区中，pack.offset为相对virAddr的偏移，
+ * 包的数据可能跨越缓冲区末尾回绕到virAddr处，详见下面示例。
  *
  * 示例：
  * @code
@@ -646,11 +648,25 @@ int IMP_Encoder_Query(int encChn, IMPEncoderChnStat *stat);
  *
  * int i, nr_pack = stream.packCount;
  * for (i = 0; i < nr_pack; i++) { //保存这一帧码流的每个包
- *     ret = write(stream_fd, (void *)stream.pack[i].virAddr,
- *                stream.pack[i].length);
- *     if (ret != stream.pack[i].length) {
- *         printf("stream write error:%s\n", strerror(errno));
- *         return -1;
+ *     IMPEncoderPack *pack = &stream.pack[i];
+ *     uint32_t remSize = stream.streamSize - pack->offset;
+ *     if (remSize < pack->length) { //码流包跨越缓冲区末尾，分两段保存
+ *         ret = write(stream_fd, (void *)(stream.virAddr + pack->offset), remSize);
+ *         if (ret != remSize) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
+ *         ret = write(stream_fd, (void *)stream.virAddr, pack->length - remSize);
+ *         if (ret != pack->length - remSize) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
+ *     } else {
+ *         ret = write(stream_fd, (void *)(stream.virAddr + pack->offset), pack->length);
+ *         if (ret != pack->length) {
+ *             printf("stream write error:%s\n", strerror(errno));
+ *             return -1;
+ *         }
  *     }
  * }
  * @endcode
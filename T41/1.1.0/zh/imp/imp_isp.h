@@ -1953,14 +1953,14 @@ typedef struct {
  * int ret = 0;
  * IMPISPAEStatisInfo info;
  *
- * ret = IMP_ISP_Tuning_GetAeStatistics(IMPVI_MAIN, &statis);
+ * ret = IMP_ISP_Tuning_GetAeStatistics(IMPVI_MAIN, &info);
  * if(ret){
  * 	IMP_LOG_ERR(TAG, "IMP_ISP_Tuning_GetAeStatistics error !\n");
  * 	return -1;
  * }
  *
  * printf("ae hist 5bin:...\n", info.ae_hist_5bin[...]);
- * printf("ae hist 256bin:...\n, info.ae_hist_256bin[...]");
+ * printf("ae hist 256bin:...\n", info.ae_hist_256bin[...]);
  * printf("ae statis:...\n", info.ae_statis.statis[...][...]);
  * @endcode
  *
@@ -2464,15 +2464,15 @@ int32_t IMP_ISP_Tuning_GetAwbWeight(IMPVI_NUM num, IMPISPWeight *awb_weight);
  * AF statistics info each area
  */
 typedef struct {
-	IMPISPStatisZone Af_Fir0;
-	IMPISPStatisZone Af_Fir1;
-	IMPISPStatisZone Af_Iir0;
-	IMPISPStatisZone Af_Iir1;
-	IMPISPStatisZone Af_YSum;
-	IMPISPStatisZone Af_HighLumaCnt;
+	IMPISPStatisZone Af_Fir0;           /**< 各区域FIR0滤波器的AF统计值 */
+	IMPISPStatisZone Af_Fir1;           /**< 各区域FIR1滤波器的AF统计值 */
+	IMPISPStatisZone Af_Iir0;           /**< 各区域IIR0滤波器的AF统计值 */
+	IMPISPStatisZone Af_Iir1;           /**< 各区域IIR1滤波器的AF统计值 */
+	IMPISPStatisZone Af_YSum;           /**< 各区域亮度和 */
+	IMPISPStatisZone Af_HighLumaCnt;    /**< 各区域高亮点的个数 */
 } IMPISPAFStatisInfo;
 /**
- * @fn IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis)
+ * @fn int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis)
  *
  * 获取AF统计值。
  *
@@ -2494,6 +2494,8 @@ typedef struct {
  * printf("af statis:...\n", ...);
  * @endcode
  *
+ * @remarks 每个成员包含15*15个区域的统计值，区域划分与IMP_ISP_Tuning_SetAfWeight的权重表一致。
+ *
  * @attention 在使用这个函数之前，IMP_ISP_EnableTuning已被调用。
  */
 int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis);
@@ -3264,7 +3266,7 @@ typedef struct {
 	uint32_t cur_r_gain;								/**< 白平衡R通道增益 */
 	uint32_t cur_b_gain;								/**< 白平衡B通道增益 */
 	uint32_t r_gain_statis;								/**< 白平衡全局统计值r_gain */
-	uint32_t b_gain_statis;								/**< 白平衡全局加权统计值b_gain */
+	uint32_t b_gain_statis;								/**< 白平衡全局统计值b_gain */
 	uint32_t r_gain_wei_statis;							/**< 白平衡全局加权统计值r_gain */
 	uint32_t b_gain_wei_statis;							/**< 白平衡全局加权统计值b_gain */
 	IMPISPAWBStatisInfo awb_statis;						/**< 白平衡区域统计值 */
@@ -3787,6 +3789,10 @@ int IMP_ISP_Tuning_DestroyOsdRgn(int chn,int handle);
  * @retval 0 成功
  * @retval 非0 失败，返回错误码
  *
+ * @remarks 每帧调用一次回调函数，应尽快返回。
+ * @remarks 如需获取该帧的统计值，可在回调函数中唤醒其他线程，再由该线程调用IMP_ISP_Tuning_GetAeStatistics、
+ * IMP_ISP_Tuning_GetAwbStatistics和IMP_ISP_Tuning_GetAfStatistics。
+ *
  * @attention 在使用这个函数之前，IMP_ISP_EnableTuning已被调用。
  */
 int32_t IMP_ISP_SetVicDoneCbFunc(void (*cb)(void));
@@ -1953,7 +1953,7 @@ typedef struct {
 /**
 * @fn int32_t IMP_ISP_Tuning_GetAeStatistics(IMPVI_NUM num, IMPISPAEStatisInfo *ae_statis)
 *
-* set ae weight
+* get ae statistics
 *
 * @param[in]   num                 The sensor num label.
 * @param[out]  ae_statis           ae statistics.
@@ -1965,14 +1965,14 @@ typedef struct {
  * int ret = 0;
  * IMPISPAEStatisInfo info;
  *
- * ret = IMP_ISP_Tuning_GetAeStatistics(IMPVI_MAIN, &statis);
+ * ret = IMP_ISP_Tuning_GetAeStatistics(IMPVI_MAIN, &info);
  * if(ret){
  * 	IMP_LOG_ERR(TAG, "IMP_ISP_Tuning_GetAeStatistics error !\n");
  * 	return -1;
  * }
  *
  * printf("ae hist 5bin:...\n", info.ae_hist_5bin[...]);
- * printf("ae hist 256bin:...\n, info.ae_hist_256bin[...]");
+ * printf("ae hist 256bin:...\n", info.ae_hist_256bin[...]);
  * printf("ae statis:...\n", info.ae_statis.statis[...][...]);
  * @endcode
  *
@@ -2479,17 +2479,17 @@ int32_t IMP_ISP_Tuning_GetAwbWeight(IMPVI_NUM num, IMPISPWeight *awb_weight);
  * AF statistics info each area
  */
 typedef struct {
-	IMPISPStatisZone Af_Fir0;
-	IMPISPStatisZone Af_Fir1;
-	IMPISPStatisZone Af_Iir0;
-	IMPISPStatisZone Af_Iir1;
-	IMPISPStatisZone Af_YSum;
-	IMPISPStatisZone Af_HighLumaCnt;
+	IMPISPStatisZone Af_Fir0;           /**< AF statistics of FIR filter 0 for each zone */
+	IMPISPStatisZone Af_Fir1;           /**< AF statistics of FIR filter 1 for each zone */
+	IMPISPStatisZone Af_Iir0;           /**< AF statistics of IIR filter 0 for each zone */
+	IMPISPStatisZone Af_Iir1;           /**< AF statistics of IIR filter 1 for each zone */
+	IMPISPStatisZone Af_YSum;           /**< Luma sum of each zone */
+	IMPISPStatisZone Af_HighLumaCnt;    /**< Number of the highlight pixels for each zone */
 } IMPISPAFStatisInfo;
 /**
  * @fn int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis)
  *
- * get awb weight
+ * get af statistics
  *
  * @param[in]    num                     The sensor num label.
  * @param[out]   af_statis               af statistics.
@@ -2509,6 +2509,8 @@ typedef struct {
  * printf("af statis:...\n", ...);
  * @endcode
  *
+ * @remarks Each member holds the statistics of 15*15 zones, laid out like the weight table of IMP_ISP_Tuning_SetAfWeight.
+ *
  * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_GetAfStatistics(IMPVI_NUM num, IMPISPAFStatisInfo *af_statis);
@@ -2573,7 +2575,7 @@ int32_t IMP_ISP_Tuning_GetAFMetricesInfo(IMPVI_NUM num, IMPISPAFMetricsInfo *met
  * }
  * @endcode
  *
- * @attention Before using that function, make sure that ISP is working properly.
+ * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_SetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
 
@@ -2600,7 +2602,7 @@ int32_t IMP_ISP_Tuning_SetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
  * printf("af weight:...\n", ...);
  * @endcode
  *
- * @attention Before using that function, make sure that ISP is working properly.
+ * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_Tuning_GetAfWeight(IMPVI_NUM num, IMPISPWeight *af_weight);
 
@@ -3156,33 +3158,33 @@ int32_t IMP_ISP_Tuning_SetDrawBlock(IMPVI_NUM num, IMPISPDrawBlockAttr *attr);
 typedef struct {
 	IMPISPAEIntegrationTimeUnit AeIntegrationTimeUnit;  /**< AE integration time unit */
 	uint32_t AeIntegrationTime;                         /**< AE integration time value */
-	uint32_t AeAGain;				    /**< AE sensor analog gain value */
-	uint32_t AeDGain;				    /**< AE sensor digital gain value */
-	uint32_t AeIspDGain;				    /**< AE ISP digital gain value */
+	uint32_t AeAGain;				    /**< AE sensor analog gain value, unit is multiple x 1024 */
+	uint32_t AeDGain;				    /**< AE sensor digital gain value, unit is multiple x 1024 */
+	uint32_t AeIspDGain;				    /**< AE ISP digital gain value, unit is multiple x 1024 */
 
 	uint32_t AeMinIntegrationTime;                      /**< AE min integration time */
-	uint32_t AeMinAGain;				    /**< AE min sensor analog gain */
-	uint32_t AeMinDgain;				    /**< AE min sensor digital gain */
-	uint32_t AeMinIspDGain;				    /**< AE min isp digital gain */
+	uint32_t AeMinAGain;				    /**< AE min sensor analog gain, unit is multiple x 1024 */
+	uint32_t AeMinDgain;				    /**< AE min sensor digital gain, unit is multiple x 1024 */
+	uint32_t AeMinIspDGain;				    /**< AE min isp digital gain, unit is multiple x 1024 */
 	uint32_t AeMaxIntegrationTime;			    /**< AE max integration time */
-	uint32_t AeMaxAGain;				    /**< AE max sensor analog gain */
-	uint32_t AeMaxDgain;				    /**< AE max sensor digital gain */
-	uint32_t AeMaxIspDGain;				    /**< AE max isp digital gain */
+	uint32_t AeMaxAGain;				    /**< AE max sensor analog gain, unit is multiple x 1024 */
+	uint32_t AeMaxDgain;				    /**< AE max sensor digital gain, unit is multiple x 1024 */
+	uint32_t AeMaxIspDGain;				    /**< AE max isp digital gain, unit is multiple x 1024 */
 
 	/* AE Manual mode attr for short frame on WDR mode*/
 	uint32_t AeShortIntegrationTime;                    /**< AE integration time value */
-	uint32_t AeShortAGain;				    /**< AE sensor analog gain value */
-	uint32_t AeShortDGain;				    /**< AE sensor digital gain value */
-	uint32_t AeShortIspDGain;			    /**< AE ISP digital gain value */
+	uint32_t AeShortAGain;				    /**< AE sensor analog gain value, unit is multiple x 1024 */
+	uint32_t AeShortDGain;				    /**< AE sensor digital gain value, unit is multiple x 1024 */
+	uint32_t AeShortIspDGain;			    /**< AE ISP digital gain value, unit is multiple x 1024 */
 
 	uint32_t AeShortMinIntegrationTime;                 /**< AE min integration time */
-	uint32_t AeShortMinAGain;			    /**< AE min sensor analog gain */
-	uint32_t AeShortMinDgain;			    /**< AE min sensor digital gain */
-	uint32_t AeShortMinIspDGain;			    /**< AE min isp digital gain */
+	uint32_t AeShortMinAGain;			    /**< AE min sensor analog gain, unit is multiple x 1024 */
+	uint32_t AeShortMinDgain;			    /**< AE min sensor digital gain, unit is multiple x 1024 */
+	uint32_t AeShortMinIspDGain;			    /**< AE min isp digital gain, unit is multiple x 1024 */
 	uint32_t AeShortMaxIntegrationTime;		    /**< AE max integration time */
-	uint32_t AeShortMaxAGain;			    /**< AE max sensor analog gain */
-	uint32_t AeShortMaxDgain;			    /**< AE max sensor digital gain */
-	uint32_t AeShortMaxIspDGain;			    /**< AE max isp digital gain */
+	uint32_t AeShortMaxAGain;			    /**< AE max sensor analog gain, unit is multiple x 1024 */
+	uint32_t AeShortMaxDgain;			    /**< AE max sensor digital gain, unit is multiple x 1024 */
+	uint32_t AeShortMaxIspDGain;			    /**< AE max isp digital gain, unit is multiple x 1024 */
 	uint32_t fps;                                       /**< sensor fps 16/16 */
 	IMPISPAEStatisAttr AeStatis;                        /**< Ae statis attrbution */
 } IMPISPAeInitAttr;
@@ -3194,13 +3196,13 @@ typedef struct {
 	IMPISPAEStatisInfo ae_info;                         /**< Ae statis information */
 	IMPISPAEIntegrationTimeUnit AeIntegrationTimeUnit;  /**< AE integration time unit */
 	uint32_t AeIntegrationTime;                         /**< AE integration time value */
-	uint32_t AeAGain;				    /**< AE sensor analog gain value */
-	uint32_t AeDGain;				    /**< AE sensor digital gain value */
-	uint32_t AeIspDGain;				    /**< AE ISP digital gain value */
+	uint32_t AeAGain;				    /**< AE sensor analog gain value, unit is multiple x 1024 */
+	uint32_t AeDGain;				    /**< AE sensor digital gain value, unit is multiple x 1024 */
+	uint32_t AeIspDGain;				    /**< AE ISP digital gain value, unit is multiple x 1024 */
 	uint32_t AeShortIntegrationTime;                    /**< AE integration time value */
-	uint32_t AeShortAGain;				    /**< AE sensor analog gain value */
-	uint32_t AeShortDGain;				    /**< AE sensor digital gain value */
-	uint32_t AeShortIspDGain;			    /**< AE ISP digital gain value */
+	uint32_t AeShortAGain;				    /**< AE sensor analog gain value, unit is multiple x 1024 */
+	uint32_t AeShortDGain;				    /**< AE sensor digital gain value, unit is multiple x 1024 */
+	uint32_t AeShortIspDGain;			    /**< AE ISP digital gain value, unit is multiple x 1024 */
 
 	uint32_t Wdr_mode;                                  /**< WDR mode or not */
 	IMPISPSENSORAttr sensor_attr;                       /**< sensor attribution */
@@ -3213,15 +3215,15 @@ typedef struct {
 	uint32_t change;                                    /**< change AE attr or not */
 	IMPISPAEIntegrationTimeUnit AeIntegrationTimeUnit;  /**< AE integration time unit */
 	uint32_t AeIntegrationTime;                         /**< AE integration time value */
-	uint32_t AeAGain;				    /**< AE sensor analog gain value */
-	uint32_t AeDGain;				    /**< AE sensor digital gain value */
-	uint32_t AeIspDGain;				    /**< AE ISP digital gain value */
+	uint32_t AeAGain;				    /**< AE sensor analog gain value, unit is multiple x 1024 */
+	uint32_t AeDGain;				    /**< AE sensor digital gain value, unit is multiple x 1024 */
+	uint32_t AeIspDGain;				    /**< AE ISP digital gain value, unit is multiple x 1024 */
 
 	/* AE Manual mode attr for short frame on WDR mode*/
 	uint32_t AeShortIntegrationTime;                    /**< AE integration time value */
-	uint32_t AeShortAGain;				    /**< AE sensor analog gain value */
-	uint32_t AeShortDGain;				    /**< AE sensor digital gain value */
-	uint32_t AeShortIspDGain;			    /**< AE ISP digital gain value */
+	uint32_t AeShortAGain;				    /**< AE sensor analog gain value, unit is multiple x 1024 */
+	uint32_t AeShortDGain;				    /**< AE sensor digital gain value, unit is multiple x 1024 */
+	uint32_t AeShortIspDGain;			    /**< AE ISP digital gain value, unit is multiple x 1024 */
 
 	uint32_t luma;                                      /**< AE Luma value */
 	uint32_t luma_scence;                               /**< AE scence Luma value */
@@ -3231,18 +3233,18 @@ typedef struct {
  * 3th custom AE library AE notify attribution
  */
 typedef enum {
-	IMPISP_AE_NOTIFY_FPS_CHANGE,                        /* AE notify the fps change*/
+	IMPISP_AE_NOTIFY_FPS_CHANGE,                        /**< AE notify the fps change */
 } IMPISPAeNotify;
 
 /**
  * AE callback function of custom auto exposure Library
  */
 typedef struct {
-	void *priv_data;								       	/* private data addr*/
-	int (*open)(void *priv_data, IMPISPAeInitAttr *AeInitAttr);                              /* AE open function for 3th custom library*/
-	void (*close)(void *priv_data);                                                         /* AE close function for 3th custom library*/
-	void (*handle)(void *priv_data, const IMPISPAeInfo *AeInfo, IMPISPAeAttr *AeAttr);      /* AE handle function for 3th custom library*/
-	int (*notify)(void *priv_data, IMPISPAeNotify notify, void *data);                      /* AE notify function for 3th custom library*/
+	void *priv_data;								       	/**< private data addr */
+	int (*open)(void *priv_data, IMPISPAeInitAttr *AeInitAttr);                              /**< AE open function for 3th custom library */
+	void (*close)(void *priv_data);                                                         /**< AE close function for 3th custom library */
+	void (*handle)(void *priv_data, const IMPISPAeInfo *AeInfo, IMPISPAeAttr *AeAttr);      /**< AE handle function for 3th custom library */
+	int (*notify)(void *priv_data, IMPISPAeNotify notify, void *data);                      /**< AE notify function for 3th custom library */
 } IMPISPAeAlgoFunc;
 
 /**
@@ -3256,7 +3258,7 @@ typedef struct {
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
- * @attention Before using that function, make sure that IMP_ISP_AddSensor have be called.
+ * @attention This function must be called immediately after IMP_ISP_AddSensor.
  */
 int32_t IMP_ISP_SetAeAlgoFunc(IMPVI_NUM num, IMPISPAeAlgoFunc *ae_func);
 
@@ -3264,48 +3266,48 @@ int32_t IMP_ISP_SetAeAlgoFunc(IMPVI_NUM num, IMPISPAeAlgoFunc *ae_func);
  * 3th custom AWB library AWB init information
  */
 typedef struct {
-	IMPISPAWBStatisAttr AwbStatis; /* awb statis attribution*/
+	IMPISPAWBStatisAttr AwbStatis; /**< awb statis attribution */
 } IMPISPAwbInitAttr;
 
 /**
  * 3th custom AWB library AWB information
  */
 typedef struct {
-	uint32_t cur_r_gain;                   /* current awb r-gain*/
-	uint32_t cur_b_gain;                   /* current awb b-gain*/
-	uint32_t r_gain_statis;                /* current awb r-gain of global statis info*/
-	uint32_t b_gain_statis;                /* current awb b-gain of global statis info*/
-	uint32_t r_gain_wei_statis;            /* current awb r-gain of global weighted statis info*/
-	uint32_t b_gain_wei_statis;            /* current awb b-gain of global weighted statis info*/
-	IMPISPAWBStatisInfo awb_statis;        /* current awb statis info for each zone*/
+	uint32_t cur_r_gain;                   /**< current awb r-gain */
+	uint32_t cur_b_gain;                   /**< current awb b-gain */
+	uint32_t r_gain_statis;                /**< current awb r-gain of global statis info */
+	uint32_t b_gain_statis;                /**< current awb b-gain of global statis info */
+	uint32_t r_gain_wei_statis;            /**< current awb r-gain of global weighted statis info */
+	uint32_t b_gain_wei_statis;            /**< current awb b-gain of global weighted statis info */
+	IMPISPAWBStatisInfo awb_statis;        /**< current awb statis info for each zone, 15 x 15 zones */
 }__attribute__((packed, aligned(1))) IMPISPAwbInfo;
 
 /**
  * 3th custom AWB library AWB attribution
  */
 typedef struct {
-	uint32_t change;  /* change awb attribution or not*/
-	uint32_t r_gain;  /* awb attribution of r-gain*/
-	uint32_t b_gain;  /* awb attribution of b-gain*/
-	uint32_t ct;      /* awb color temp*/
+	uint32_t change;  /**< change awb attribution or not */
+	uint32_t r_gain;  /**< awb attribution of r-gain */
+	uint32_t b_gain;  /**< awb attribution of b-gain */
+	uint32_t ct;      /**< awb color temp */
 } IMPISPAwbAttr;
 
 /**
  * 3th custom AWB library AWB notify attribution
  */
 typedef enum {
-	IMPISP_AWB_NOTIFY_MODE_CHANGE,
+	IMPISP_AWB_NOTIFY_MODE_CHANGE,                        /**< Current AWB mode change */
 } IMPISPAwbNotify;
 
 /**
  * 3th custom AWB library callback functions
  */
 typedef struct {
-	void *priv_data;                                                                                 /* private data addr*/
-	int (*open)(void *priv_data, IMPISPAwbInitAttr *AwbInitAttr);					 /* AWB open function for 3th custom library*/
-	void (*close)(void *priv_data);									 /* AWB close function for 3th custom library*/
-	void (*handle)(void *priv_data, const IMPISPAwbInfo *AwbInfo, IMPISPAwbAttr *AwbAttr);		 /* AWB handle function for 3th custom library*/
-	int (*notify)(void *priv_data, IMPISPAwbNotify notify, void *data);				 /* AWB notify function for 3th custom library*/
+	void *priv_data;                                                                                 /**< private data addr */
+	int (*open)(void *priv_data, IMPISPAwbInitAttr *AwbInitAttr);					 /**< AWB open function for 3th custom library */
+	void (*close)(void *priv_data);									 /**< AWB close function for 3th custom library */
+	void (*handle)(void *priv_data, const IMPISPAwbInfo *AwbInfo, IMPISPAwbAttr *AwbAttr);		 /**< AWB handle function for 3th custom library */
+	int (*notify)(void *priv_data, IMPISPAwbNotify notify, void *data);				 /**< AWB notify function for 3th custom library */
 } IMPISPAwbAlgoFunc;
 
 /**
@@ -3319,7 +3321,7 @@ typedef struct {
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
- * @attention Before using that function, make sure that IMP_ISP_AddSensor have be called.
+ * @attention This function must be called immediately after IMP_ISP_AddSensor.
  */
 int32_t IMP_ISP_SetAwbAlgoFunc(IMPVI_NUM num, IMPISPAwbAlgoFunc *awb_func);
 
@@ -3788,13 +3790,17 @@ int IMP_ISP_Tuning_DestroyOsdRgn(int chn,int handle);
 /**
  * @fn int32_t IMP_ISP_SetVicDoneCbFunc(void (*cb)(void))
  *
- * When a frame of data is accepted, the callback function will be executed.
+ * The callback function is executed each time the ISP VIC finishes receiving a frame.
  *
  * @param[in] cb 	The pointer for callback function.
  *
  * @retval 0 means success.
  * @retval Other values mean failure, its value is an error code.
  *
+ * @remarks The callback is called once for each frame and should return quickly.
+ * @remarks To get the statistics of the frame, wake up another thread in the callback and call IMP_ISP_Tuning_GetAeStatistics,
+ * IMP_ISP_Tuning_GetAwbStatistics and IMP_ISP_Tuning_GetAfStatistics from there.
+ *
  * @attention Before using it, make sure that 'IMP_ISP_EnableTuning' is working properly.
  */
 int32_t IMP_ISP_SetVicDoneCbFunc(void (*cb)(void));